@@ -0,0 +1,189 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+//[example_corpus
+
+/*
+    This example memory-maps a file holding
+    one URL per line and parses it with
+    url_corpus, which splits the file into
+    chunks parsed on multiple threads.
+
+    The parsed urls reference the mapped
+    pages, so no characters are copied and
+    the file is never read into a buffer.
+*/
+
+#include <boost/url/url_corpus.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+
+#ifdef _WIN32
+# ifndef WIN32_LEAN_AND_MEAN
+#  define WIN32_LEAN_AND_MEAN
+# endif
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace urls = boost::urls;
+namespace core = boost::core;
+
+// A read-only mapping of an entire file
+class mapped_file
+{
+    char const* data_ = nullptr;
+    std::size_t size_ = 0;
+#ifdef _WIN32
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE map_ = nullptr;
+#endif
+
+public:
+    mapped_file() = default;
+    mapped_file(mapped_file const&) = delete;
+    mapped_file& operator=(mapped_file const&) = delete;
+
+    ~mapped_file()
+    {
+#ifdef _WIN32
+        if(data_)
+            ::UnmapViewOfFile(data_);
+        if(map_)
+            ::CloseHandle(map_);
+        if(file_ != INVALID_HANDLE_VALUE)
+            ::CloseHandle(file_);
+#else
+        if(size_ != 0)
+            ::munmap(const_cast<char*>(data_), size_);
+#endif
+    }
+
+    bool
+    open(char const* path)
+    {
+#ifdef _WIN32
+        file_ = ::CreateFileA(path, GENERIC_READ,
+            FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if(file_ == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER size;
+        if(! ::GetFileSizeEx(file_, &size))
+            return false;
+        if(size.QuadPart == 0)
+            return true;
+        map_ = ::CreateFileMappingA(file_, nullptr,
+            PAGE_READONLY, 0, 0, nullptr);
+        if(! map_)
+            return false;
+        data_ = static_cast<char const*>(
+            ::MapViewOfFile(map_, FILE_MAP_READ, 0, 0, 0));
+        if(! data_)
+            return false;
+        size_ = static_cast<std::size_t>(size.QuadPart);
+#else
+        int fd = ::open(path, O_RDONLY);
+        if(fd == -1)
+            return false;
+        struct stat st;
+        if(::fstat(fd, &st) == -1)
+        {
+            ::close(fd);
+            return false;
+        }
+        if(st.st_size == 0)
+        {
+            ::close(fd);
+            return true;
+        }
+        void* p = ::mmap(nullptr,
+            static_cast<std::size_t>(st.st_size),
+            PROT_READ, MAP_PRIVATE, fd, 0);
+        // the mapping remains after the
+        // descriptor is closed
+        ::close(fd);
+        if(p == MAP_FAILED)
+            return false;
+        data_ = static_cast<char const*>(p);
+        size_ = static_cast<std::size_t>(st.st_size);
+#endif
+        return true;
+    }
+
+    core::string_view
+    text() const noexcept
+    {
+        return core::string_view(data_, size_);
+    }
+};
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cout << argv[0] << "\n";
+        std::cout << "Usage: corpus <file> [<threads>]\n"
+                     "options:\n"
+                     "    <file>:       File with one URL per line (required)\n"
+                     "    <threads>:    Number of threads (default: hardware threads)\n"
+                     "examples:\n"
+                     "corpus urls.txt 8\n";
+        return EXIT_FAILURE;
+    }
+
+    mapped_file f;
+    if (!f.open(argv[1]))
+    {
+        std::cerr << "Cannot open " << argv[1] << "\n";
+        return EXIT_FAILURE;
+    }
+
+    urls::url_corpus::options opt;
+    if (argc > 2)
+        opt.threads = std::strtoul(argv[2], nullptr, 10);
+    urls::url_corpus uc(f.text(), opt);
+
+    // tally the results of each chunk
+    std::size_t absolute = 0;
+    std::map<std::string, std::size_t> schemes;
+    for (auto const& c : uc.chunks())
+    {
+        if (c.errors != 0)
+            std::cerr <<
+                "line " << c.first_error_line + 1 << ": " <<
+                c.first_error.message() << "\n";
+        for (auto const& u : c.urls)
+        {
+            if (u.has_scheme())
+            {
+                ++absolute;
+                ++schemes[u.scheme()];
+            }
+        }
+    }
+
+    std::cout <<
+        "chunks:   " << uc.chunks().size() << "\n"
+        "lines:    " << uc.lines()         << "\n"
+        "urls:     " << uc.size()          << "\n"
+        "absolute: " << absolute           << "\n"
+        "errors:   " << uc.errors()        << "\n";
+    for (auto const& e : schemes)
+        std::cout << "    " << e.first << ": " << e.second << "\n";
+
+    return EXIT_SUCCESS;
+}
+
+//]
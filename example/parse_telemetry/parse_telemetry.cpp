@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+//[example_parse_telemetry
+
+/*
+    This example parses a file holding one
+    URL per line, then prints the counters
+    of each grammar rule used: how many times
+    it was used, how many times it failed and
+    with which errors, and how many characters
+    it consumed.
+
+    The counters exist only when the library
+    and this program are built with the macro
+    BOOST_URL_ENABLE_TELEMETRY defined, for
+    example with the CMake option of the same
+    name.
+*/
+
+#include <boost/url/grammar/telemetry.hpp>
+#include <boost/url/parse.hpp>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace urls = boost::urls;
+namespace grammar = boost::urls::grammar;
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cout << argv[0] << "\n";
+        std::cout << "Usage: parse_telemetry <file>\n"
+                     "options:\n"
+                     "    <file>:       File with one URL per line (required)\n"
+                     "examples:\n"
+                     "parse_telemetry urls.txt\n";
+        return EXIT_FAILURE;
+    }
+
+#ifndef BOOST_URL_ENABLE_TELEMETRY
+    std::cerr <<
+        "Telemetry is compiled out; rebuild with "
+        "BOOST_URL_ENABLE_TELEMETRY defined\n";
+#endif
+
+    std::ifstream in(argv[1]);
+    if (!in)
+    {
+        std::cerr << "Cannot open " << argv[1] << "\n";
+        return EXIT_FAILURE;
+    }
+
+    std::size_t lines = 0;
+    std::size_t errors = 0;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        ++lines;
+        if (!urls::parse_uri_reference(line))
+            ++errors;
+    }
+    std::cout <<
+        "lines:  " << lines  << "\n"
+        "errors: " << errors << "\n\n";
+
+    std::cout <<
+        std::setw(12) << "calls" <<
+        std::setw(12) << "failures" <<
+        std::setw(14) << "bytes" << "  rule\n";
+    for (auto const& t : grammar::telemetry_snapshot())
+    {
+        std::cout <<
+            std::setw(12) << t.calls <<
+            std::setw(12) << t.failures <<
+            std::setw(14) << t.bytes << "  " <<
+            t.name << "\n";
+
+        // the failures of the rule, by error
+        for (std::size_t i = 0;
+                i < grammar::rule_telemetry::error_buckets; ++i)
+        {
+            if (t.errors[i] == 0)
+                continue;
+            std::cout <<
+                std::setw(24) << t.errors[i] << "    ";
+            if (i == 0)
+                std::cout << "(other)\n";
+            else
+                std::cout << make_error_code(
+                    static_cast<grammar::error>(i)).message() << "\n";
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+//]
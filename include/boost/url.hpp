@@ -12,41 +12,62 @@
 
 #include <boost/url/grammar.hpp>
 
+#include <boost/url/alloc_stats.hpp>
 #include <boost/url/authority_view.hpp>
+#include <boost/url/compact_url.hpp>
+#include <boost/url/concurrent_url_set.hpp>
+#include <boost/url/decode_as.hpp>
 #include <boost/url/decode_view.hpp>
 #include <boost/url/encode.hpp>
 #include <boost/url/encoding_opts.hpp>
 #include <boost/url/error.hpp>
 #include <boost/url/error_types.hpp>
 #include <boost/url/format.hpp>
+#include <boost/url/host_interner.hpp>
 #include <boost/url/host_type.hpp>
 #include <boost/url/ignore_case.hpp>
 #include <boost/url/ipv4_address.hpp>
 #include <boost/url/ipv6_address.hpp>
+#include <boost/url/mount_table.hpp>
 #include <boost/url/optional.hpp>
 #include <boost/url/param.hpp>
 #include <boost/url/params_base.hpp>
 #include <boost/url/params_encoded_base.hpp>
+#include <boost/url/params_encoded_index.hpp>
 #include <boost/url/params_encoded_ref.hpp>
 #include <boost/url/params_encoded_view.hpp>
 #include <boost/url/params_ref.hpp>
 #include <boost/url/params_view.hpp>
 #include <boost/url/parse.hpp>
+#include <boost/url/parse_cache.hpp>
 #include <boost/url/parse_path.hpp>
 #include <boost/url/parse_query.hpp>
 #include <boost/url/pct_string_view.hpp>
+#include <boost/url/resolve_into.hpp>
 #include <boost/url/scheme.hpp>
 #include <boost/url/segments_base.hpp>
 #include <boost/url/segments_encoded_base.hpp>
+#include <boost/url/segments_encoded_index.hpp>
 #include <boost/url/segments_encoded_ref.hpp>
 #include <boost/url/segments_encoded_view.hpp>
 #include <boost/url/segments_ref.hpp>
 #include <boost/url/segments_view.hpp>
+#include <boost/url/serialize.hpp>
+#include <boost/url/shared_url.hpp>
+#include <boost/url/small_url.hpp>
 #include <boost/url/static_url.hpp>
 #include <boost/url/string_view.hpp>
 #include <boost/core/detail/string_view.hpp>
 #include <boost/url/url.hpp>
 #include <boost/url/url_base.hpp>
+#include <boost/url/url_blocklist.hpp>
+#include <boost/url/url_columns.hpp>
+#include <boost/url/url_corpus.hpp>
+#include <boost/url/url_hash.hpp>
+#include <boost/url/url_pattern.hpp>
+#include <boost/url/url_pattern_set.hpp>
+#include <boost/url/url_scanner.hpp>
+#include <boost/url/url_set.hpp>
 #include <boost/url/url_view.hpp>
 #include <boost/url/url_view_base.hpp>
 #include <boost/url/urls.hpp>
@@ -0,0 +1,120 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_ALLOC_STATS_HPP
+#define BOOST_URL_ALLOC_STATS_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+
+/** The memory counters of modifiable urls
+
+    An object of this type holds the number
+    of buffers allocated by modifiable urls,
+    and the number of characters copied or
+    moved within them, either for a single
+    url as returned by @ref url_base::stats,
+    or for every url of the program as
+    returned by @ref alloc_stats_snapshot.
+
+    The counters are kept only when the
+    library and the program are compiled
+    with the macro `BOOST_URL_ENABLE_TELEMETRY`
+    defined. Otherwise, which is the default,
+    every counter is zero.
+
+    @see
+        @ref alloc_stats_reset,
+        @ref alloc_stats_snapshot,
+        @ref url_base::stats.
+*/
+struct alloc_stats
+{
+    /** The number of buffers allocated
+    */
+    std::uint64_t allocations = 0;
+
+    /** The number of allocations which replaced a previous buffer
+    */
+    std::uint64_t reallocations = 0;
+
+    /** The number of bytes allocated, including null terminators
+    */
+    std::uint64_t bytes = 0;
+
+    /** The number of characters copied to a new buffer when growing
+    */
+    std::uint64_t copied = 0;
+
+    /** The number of characters moved within a buffer by modifiers
+    */
+    std::uint64_t moved = 0;
+
+    /** The largest capacity of a buffer, excluding the null terminator
+    */
+    std::size_t peak_capacity = 0;
+};
+
+/** Return the memory counters of every modifiable url
+
+    This function returns the sum of the
+    counters of all the modifiable urls of the
+    program so far, and the largest capacity
+    that any of them reached.
+
+    The counters are read without locks, while
+    other threads may be modifying urls, so
+    that the counters may be from slightly
+    different moments.
+
+    @par Example
+    @code
+    url u( "https://www.example.com" );
+    u.set_path( "/path/to/file.txt" );
+    alloc_stats st = alloc_stats_snapshot();
+    std::cout << st.allocations << " allocations, " << st.copied << " characters copied\n";
+    @endcode
+
+    @par Exception Safety
+    Throws nothing.
+
+    @see
+        @ref alloc_stats,
+        @ref alloc_stats_reset,
+        @ref url_base::stats.
+*/
+BOOST_URL_DECL
+alloc_stats
+alloc_stats_snapshot() noexcept;
+
+/** Set the memory counters of every modifiable url to zero
+
+    This resets the counters returned by
+    @ref alloc_stats_snapshot. The counters
+    of each url, returned by @ref url_base::stats,
+    are not changed.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @see
+        @ref alloc_stats_snapshot.
+*/
+BOOST_URL_DECL
+void
+alloc_stats_reset() noexcept;
+
+} // urls
+} // boost
+
+#endif
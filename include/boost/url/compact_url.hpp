@@ -0,0 +1,270 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_COMPACT_URL_HPP
+#define BOOST_URL_COMPACT_URL_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/host_interner.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/scheme.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+/** A URL whose host is stored in a @ref host_interner
+
+    This container holds a url in a compact
+    form for large collections, in which many
+    urls share few hosts. Instead of the
+    characters of the host, the object stores
+    the host id assigned by a
+    @ref host_interner, along with the port
+    number, the scheme id, and one allocation
+    holding the path, query, and fragment.
+    The scheme and userinfo are stored in
+    that allocation only when present and,
+    for the scheme, when it is not one of
+    the well-known schemes.
+
+    The url is stored with its scheme and host
+    normalized to lower case, so the url
+    which is reconstituted by @ref view or
+    @ref to_url may differ in case from the
+    original in those parts. All other
+    characters are preserved.
+
+    @par Example
+    @code
+    host_interner hi;
+    compact_url cu( url_view( "https://www.example.com/path/to/file.txt?q=1" ), hi );
+
+    assert( hi.host( cu.host_id() ) == "www.example.com" );
+    assert( cu.encoded_resource() == "/path/to/file.txt?q=1" );
+
+    std::string buf;
+    url_view u = cu.view( hi, buf );
+    assert( u.buffer() == "https://www.example.com/path/to/file.txt?q=1" );
+    @endcode
+
+    @see
+        @ref host_interner.
+*/
+class BOOST_URL_DECL compact_url
+{
+    std::unique_ptr<char[]> p_;
+    std::uint32_t n_ = 0;
+    std::uint32_t host_ = 0;
+    std::uint16_t port_ = 0;
+    scheme scheme_ = scheme::none;
+    unsigned char flags_ = 0;
+
+    std::size_t
+    write(
+        host_interner const& hi,
+        char* dest) const noexcept;
+
+public:
+    /** Constructor
+
+        Default constructed urls are empty,
+        and refer to no host.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    compact_url() noexcept = default;
+
+    /** Constructor
+
+        The host of `u` is interned in `hi`,
+        and the remaining parts are stored.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `u.size() > 0xffffffff`, or `hi` is full.
+
+        @param u The url to store.
+
+        @param hi The interner to add the host to.
+    */
+    compact_url(
+        url_view_base const& u,
+        host_interner& hi);
+
+    /** Constructor
+
+        @par Exception Safety
+        Calls to allocate may throw.
+    */
+    compact_url(
+        compact_url const& other);
+
+    /** Constructor
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    compact_url(
+        compact_url&& other) noexcept;
+
+    /** Assignment
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+    */
+    compact_url&
+    operator=(compact_url const& other);
+
+    /** Assignment
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    compact_url&
+    operator=(compact_url&& other) noexcept;
+
+    /** Return the id of the host
+
+        The id of the empty string is
+        returned for a url without an
+        authority.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::uint32_t
+    host_id() const noexcept
+    {
+        return host_;
+    }
+
+    /** Return the scheme id
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    scheme
+    scheme_id() const noexcept
+    {
+        return scheme_;
+    }
+
+    /** Return true if a port is present
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    has_port() const noexcept
+    {
+        return (flags_ & 4) != 0;
+    }
+
+    /** Return the port number
+
+        Zero is returned if there is
+        no port number.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::uint16_t
+    port_number() const noexcept
+    {
+        return port_;
+    }
+
+    /** Return the path, query, and fragment
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    pct_string_view
+    encoded_resource() const noexcept;
+
+    /** Return the number of bytes of memory used
+
+        This includes the size of the object.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    memory_usage() const noexcept
+    {
+        return sizeof(*this) + n_;
+    }
+
+    /** Return the size of the reconstituted url
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param hi The interner holding the host.
+    */
+    std::size_t
+    size(host_interner const& hi) const noexcept;
+
+    /** Return a view of the url
+
+        The characters of the url are written
+        to `buf`, which the returned view
+        references.
+
+        @par Preconditions
+        `hi` is the interner which was used
+        to construct this object.
+
+        @par Complexity
+        Linear in the size of the url.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param hi The interner holding the host.
+
+        @param buf The storage for the characters.
+    */
+    url_view
+    view(
+        host_interner const& hi,
+        std::string& buf) const;
+
+    /** Return the url
+
+        @par Preconditions
+        `hi` is the interner which was used
+        to construct this object.
+
+        @par Complexity
+        Linear in the size of the url.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param hi The interner holding the host.
+    */
+    url
+    to_url(host_interner const& hi) const;
+};
+
+} // urls
+} // boost
+
+#endif
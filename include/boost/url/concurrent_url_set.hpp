@@ -0,0 +1,259 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_CONCURRENT_URL_SET_HPP
+#define BOOST_URL_CONCURRENT_URL_SET_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace boost {
+namespace urls {
+
+/** A set of URLs which may be shared between threads
+
+    This container records which urls have
+    been seen, so that each equivalent url is
+    inserted only once. Two urls are equivalent
+    when they compare equal with `operator==`
+    for @ref url_view_base, that is, after
+    normalization; the set hashes urls with
+    @ref url_hash.
+
+    The set is divided into shards, each
+    protected by its own lock. A url is stored
+    in the shard selected by its digest, in an
+    open addressing table which refers to the
+    characters of the url and its parsed
+    offsets, copied into blocks of memory
+    owned by the shard. Threads inserting
+    different urls therefore rarely contend.
+
+    When constructed with a nonzero
+    @ref options::filter_bits, the set instead
+    operates as a blocked Bloom filter of that
+    many bits, which is updated without locks.
+    No urls are stored and the memory used is
+    fixed, at the cost of a small probability
+    that a url never inserted is reported as
+    present.
+
+    @par Example
+    @code
+    concurrent_url_set seen;
+
+    assert( seen.insert( url_view( "https://www.example.com/index.htm" ) ) );
+    assert( ! seen.insert( url_view( "HTTPS://WWW.EXAMPLE.COM/./index.htm" ) ) );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.
+    Shared objects: Safe, except for
+    @ref clear which may not be called
+    concurrently with any other function.
+    When the library is built with
+    `BOOST_URL_DISABLE_THREADS`, shards
+    have no locks and shared objects
+    are unsafe.
+
+    @see
+        @ref url_hash.
+*/
+class BOOST_URL_DECL concurrent_url_set
+{
+public:
+    /** Options for constructing the set
+    */
+    struct options
+    {
+        /** The number of shards
+
+            The value is rounded up to a power
+            of two. More shards reduce
+            contention between threads.
+        */
+        std::size_t shards = 64;
+
+        /** The number of bits in the filter
+
+            If this is zero, the set stores
+            every url and answers exactly.
+            Otherwise, the set is a filter which
+            uses this many bits, rounded up to
+            a multiple of 512.
+        */
+        std::size_t filter_bits = 0;
+
+        /** The number of bits set per url in the filter
+
+            This must be between 1 and 16.
+        */
+        std::size_t filter_hashes = 7;
+    };
+
+    /** Destructor
+    */
+    ~concurrent_url_set();
+
+    /** Constructor
+
+        Default constructed sets store urls
+        exactly, using 64 shards.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+    */
+    concurrent_url_set();
+
+    /** Constructor
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `opt.shards == 0`, or
+        `opt.filter_hashes` is out of range.
+
+        @param opt The options to use.
+    */
+    explicit
+    concurrent_url_set(
+        options const& opt);
+
+    concurrent_url_set(
+        concurrent_url_set const&) = delete;
+    concurrent_url_set& operator=(
+        concurrent_url_set const&) = delete;
+
+    /** Return true if the set is a filter
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    is_filter() const noexcept
+    {
+        return nbits_ != 0;
+    }
+
+    /** Insert a url
+
+        If no url equivalent to `u` is in the
+        set, then `u` is inserted. For a filter,
+        a url is considered present if all of
+        its bits were already set.
+
+        @par Example
+        @code
+        concurrent_url_set seen;
+
+        if( seen.insert( u ) )
+            frontier.push( u );
+        @endcode
+
+        @par Complexity
+        Linear in `u.size()`, amortized.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        A filter throws nothing.
+
+        @return `true` if the url was inserted,
+        or `false` if an equivalent url was
+        already present.
+
+        @param u The url to insert.
+    */
+    bool
+    insert(url_view_base const& u);
+
+    /** Return true if an equivalent url is present
+
+        For a filter, `true` may be returned
+        for a url which was never inserted.
+
+        @par Complexity
+        Linear in `u.size()`.
+
+        @par Exception Safety
+        Exceptions thrown on failure to lock.
+        A filter throws nothing.
+
+        @throw std::system_error
+        The shard could not be locked.
+
+        @param u The url to look up.
+    */
+    bool
+    contains(
+        url_view_base const& u) const;
+
+    /** Return the number of urls inserted
+
+        For a filter, this is the number of
+        calls to @ref insert which returned
+        `true`.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return size_.load(
+            std::memory_order_relaxed);
+    }
+
+    /** Return the number of bytes of memory used
+
+        This includes the tables, the stored
+        urls, and the filter bits.
+
+        @par Exception Safety
+        Exceptions thrown on failure to lock.
+        A filter throws nothing.
+
+        @throw std::system_error
+        A shard could not be locked.
+    */
+    std::size_t
+    memory_usage() const;
+
+    /** Remove all urls
+
+        Memory used for stored urls is released.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    void
+    clear() noexcept;
+
+private:
+    struct shard;
+
+    std::unique_ptr<shard[]> shards_;
+    std::unique_ptr<
+        std::atomic<std::uint64_t>[]> bits_;
+    std::size_t shard_mask_ = 0;
+    std::size_t nbits_ = 0;
+    std::size_t k_ = 0;
+    std::atomic<std::size_t> size_{0};
+};
+
+} // urls
+} // boost
+
+#endif
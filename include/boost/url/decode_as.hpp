@@ -0,0 +1,111 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DECODE_AS_HPP
+#define BOOST_URL_DECODE_AS_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/encoding_opts.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <type_traits>
+
+namespace boost {
+namespace urls {
+
+/** Decode and convert an encoded string to an arithmetic value
+
+    This function converts a string which
+    may contain percent-escapes, such as the
+    value of a query parameter, to a value
+    of type `T`. Escapes are decoded into
+    automatic storage as the value is
+    converted; no memory is allocated.
+
+    The accepted syntax depends on `T`:
+
+    @li For `bool`, the strings `"1"`,
+        `"true"`, `"yes"`, and `"on"` convert
+        to `true`, while `"0"`, `"false"`,
+        `"no"`, and `"off"` convert to `false`.
+        The comparison is case-insensitive.
+
+    @li For unsigned integers, the decimal
+        syntax of @ref grammar::unsigned_rule
+        is used.
+
+    @li For signed integers, the decimal
+        syntax of @ref grammar::unsigned_rule
+        is used with an optional leading
+        `"-"` or `"+"`.
+
+    @li For floating point types, a decimal
+        number with an optional sign, fraction,
+        and exponent is accepted. Infinities,
+        NaNs, and hexadecimal floats are
+        rejected.
+
+    The entire decoded string must match.
+
+    @par Example
+    @code
+    system::result< int > rv = decode_as< int >( "%2D42" );
+    assert( rv.value() == -42 );
+    @endcode
+
+    @par BNF
+    @code
+    boolean     = "1" / "0" / "true" / "false" / "yes" / "no" / "on" / "off"
+    unsigned    = "0" / ( ["1"..."9"] *DIGIT )
+    signed      = [ "-" / "+" ] unsigned
+    floating    = [ "-" / "+" ] ( 1*DIGIT [ "." *DIGIT ] / "." 1*DIGIT )
+                  [ ( "e" / "E" ) [ "-" / "+" ] 1*DIGIT ]
+    @endcode
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return The converted value, or an error
+    code. The error is @ref grammar::error::mismatch
+    or @ref grammar::error::leftover when the
+    decoded string does not match the syntax,
+    @ref grammar::error::invalid when the
+    syntax matches but is disallowed, such as
+    an integer with extra leading zeroes,
+    and @ref grammar::error::out_of_range when
+    the value cannot be represented by `T`.
+
+    @param s The string to convert, which
+    may contain percent-escapes.
+
+    @param opt The options for decoding. If
+    this parameter is omitted, the default
+    options are used.
+
+    @tparam T The arithmetic type to convert to.
+
+    @see
+        @ref params_base::get_as,
+        @ref params_encoded_base::get_as.
+*/
+template<class T>
+system::result<T>
+decode_as(
+    pct_string_view s,
+    encoding_opts opt = {}) noexcept;
+
+} // urls
+} // boost
+
+#include <boost/url/impl/decode_as.hpp>
+
+#endif
@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_GLOB_NFA_HPP
+#define BOOST_URL_DETAIL_GLOB_NFA_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+/*  An automaton matching a string against
+    any number of glob patterns at once.
+
+    In a pattern, `*` matches any run of
+    characters other than '/', `**` matches
+    any run of characters, and a backslash
+    makes the next character literal.
+
+    The states of all patterns are stored
+    consecutively in one bit set, which is
+    advanced for each character of the
+    input with a few masks looked up by the
+    class of the character, as in the
+    Shift-And algorithm.
+*/
+class glob_nfa
+{
+    // class of each character
+    std::uint16_t cls_[256] = {};
+    std::size_t nclass_ = 0;
+    std::size_t words_ = 0;
+
+    // for each class, the states which
+    // advance on a character of the class
+    std::vector<std::uint64_t> adv_;
+
+    // for each class, the states which
+    // remain on a character of the class
+    std::vector<std::uint64_t> stay_;
+
+    // states which also reach the next
+    // state without consuming a character
+    std::vector<std::uint64_t> eps_;
+
+    std::vector<std::uint64_t> start_;
+
+    // accepting state of each pattern
+    std::vector<std::size_t> final_;
+
+public:
+    // Build the automaton for the patterns.
+    // If icase is true, letters match
+    // without regard to case.
+    BOOST_URL_DECL
+    void
+    build(
+        core::string_view const* patterns,
+        std::size_t n,
+        bool icase);
+
+    // Return the number of patterns
+    std::size_t
+    size() const noexcept
+    {
+        return final_.size();
+    }
+
+    // Return the number of words
+    // in the set of states
+    std::size_t
+    words() const noexcept
+    {
+        return words_;
+    }
+
+    // Run the automaton on s. The buffer must
+    // hold 2 * words() words. Returns the set of
+    // states, or null if no pattern matched.
+    BOOST_URL_DECL
+    std::uint64_t const*
+    run(
+        core::string_view s,
+        std::uint64_t* buf) const noexcept;
+
+    // Return true if pattern i accepted
+    bool
+    accepted(
+        std::uint64_t const* states,
+        std::size_t i) const noexcept
+    {
+        auto const b = final_[i];
+        return (states[b / 64] >>
+            (b % 64)) & 1;
+    }
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -45,6 +45,17 @@ struct identifier_rule_t
     parse(
         char const*& it,
         char const* end) const noexcept;
+
+    static
+    constexpr
+    bool
+    first_chars(char c) noexcept
+    {
+        return
+            (c >= 'a' && c <= 'z') ||
+            (c >= 'A' && c <= 'Z') ||
+            c == '_';
+    }
 };
 
 constexpr identifier_rule_t identifier_rule{};
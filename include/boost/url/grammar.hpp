@@ -30,6 +30,7 @@
 #include <boost/url/grammar/recycled.hpp>
 #include <boost/url/grammar/string_token.hpp>
 #include <boost/url/grammar/string_view_base.hpp>
+#include <boost/url/grammar/telemetry.hpp>
 #include <boost/url/grammar/token_rule.hpp>
 #include <boost/url/grammar/tuple_rule.hpp>
 #include <boost/url/grammar/type_traits.hpp>
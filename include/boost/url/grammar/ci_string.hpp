@@ -131,6 +131,9 @@ ci_compare(
     unordered containers.
     The function is defined only for strings
     containing low-ASCII characters.
+    Digests are the same on every platform,
+    independent of the byte order and of the
+    instructions used to compute them.
 
     @return The digest
 
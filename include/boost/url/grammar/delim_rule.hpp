@@ -38,6 +38,13 @@ struct ch_delim_rule
         char const*& it,
         char const* end) const noexcept;
 
+    constexpr
+    bool
+    first_chars(char c) const noexcept
+    {
+        return c == ch_;
+    }
+
 private:
     char ch_;
 };
@@ -118,6 +125,12 @@ struct cs_delim_rule
             it++, 1 };
     }
 
+    bool
+    first_chars(char c) const noexcept
+    {
+        return cs_(c);
+    }
+
 private:
     CharSet cs_;
 };
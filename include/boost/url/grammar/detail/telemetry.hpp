@@ -0,0 +1,109 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_GRAMMAR_DETAIL_TELEMETRY_HPP
+#define BOOST_URL_GRAMMAR_DETAIL_TELEMETRY_HPP
+
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <boost/core/typeinfo.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+namespace grammar {
+namespace detail {
+
+// the number of buckets of failures;
+// bucket 0 holds codes which are not
+// in the category of grammar::error
+constexpr std::size_t telemetry_errors = 8;
+
+// The counters of one rule, linked into
+// a list when the rule is first used
+struct rule_counters
+{
+    char const* name;
+    std::atomic<std::uint64_t> calls;
+    std::atomic<std::uint64_t> failures;
+    std::atomic<std::uint64_t> bytes;
+    std::atomic<std::uint64_t> errors[telemetry_errors];
+    rule_counters* next = nullptr;
+
+    explicit
+    rule_counters(char const* s) noexcept
+        : name(s)
+        , calls(0)
+        , failures(0)
+        , bytes(0)
+    {
+        for(auto& e : errors)
+            e.store(0, std::memory_order_relaxed);
+    }
+
+    template<class T>
+    void
+    count(
+        std::size_t n,
+        system::result<T> const& rv) noexcept
+    {
+        calls.fetch_add(1,
+            std::memory_order_relaxed);
+        if(rv)
+        {
+            bytes.fetch_add(n,
+                std::memory_order_relaxed);
+            return;
+        }
+        failures.fetch_add(1,
+            std::memory_order_relaxed);
+        auto const& ec = rv.error();
+        std::size_t i = 0;
+        if( ec.category() == error_cat &&
+            ec.value() > 0 &&
+            static_cast<std::size_t>(
+                ec.value()) < telemetry_errors)
+            i = static_cast<std::size_t>(
+                ec.value());
+        errors[i].fetch_add(1,
+            std::memory_order_relaxed);
+    }
+};
+
+BOOST_URL_DECL
+void
+add_rule_counters(
+    rule_counters& c) noexcept;
+
+// return the counters of the rule R
+template<class R>
+rule_counters&
+counters_of() noexcept
+{
+    static rule_counters c(
+        BOOST_CORE_TYPEID(R).name());
+    static bool const added =
+        (add_rule_counters(c), true);
+    (void)added;
+    return c;
+}
+
+} // detail
+} // grammar
+} // urls
+} // boost
+
+#endif
+
+#endif
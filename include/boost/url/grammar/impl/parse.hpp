@@ -12,6 +12,7 @@
 
 #include <boost/url/grammar/error.hpp>
 #include <boost/url/grammar/type_traits.hpp>
+#include <boost/url/grammar/detail/telemetry.hpp>
 
 namespace boost {
 namespace urls {
@@ -33,7 +34,15 @@ parse(
         is_rule<R>::value,
         "Rule requirements not met");
 
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+    auto const it0 = it;
+    auto rv = r.parse(it, end);
+    detail::counters_of<R>().count(
+        static_cast<std::size_t>(it - it0), rv);
+    return rv;
+#else
     return r.parse(it, end);
+#endif
 }
 
 template<BOOST_URL_CONSTRAINT(Rule) R>
@@ -54,6 +63,10 @@ parse(
     auto it = s.data();
     auto const end = it + s.size();
     auto rv = r.parse(it, end);
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+    detail::counters_of<R>().count(
+        static_cast<std::size_t>(it - s.data()), rv);
+#endif
     if( rv &&
         it != end)
         return error::leftover;
@@ -13,6 +13,7 @@
 #include <boost/url/grammar/error.hpp>
 #include <boost/url/grammar/parse.hpp>
 #include <boost/static_assert.hpp>
+#include <boost/mp11/algorithm.hpp>
 #include <cstdint>
 #include <type_traits>
 
@@ -22,6 +23,46 @@ namespace grammar {
 
 namespace detail {
 
+template<class R, class = void>
+struct has_first_chars : std::false_type {};
+
+template<class R>
+struct has_first_chars<R, void_t<
+    decltype(
+    std::declval<bool&>() =
+        std::declval<R const&>().first_chars(
+            std::declval<char>())
+            ) > > : std::true_type
+{
+};
+
+// return false if `r` cannot
+// match the input at `it`
+template<class R>
+bool
+maybe_match(
+    R const& r,
+    char const* it,
+    char const* end,
+    std::true_type const&) noexcept
+{
+    return
+        it != end &&
+        r.first_chars(*it);
+}
+
+template<class R>
+constexpr
+bool
+maybe_match(
+    R const&,
+    char const*,
+    char const*,
+    std::false_type const&) noexcept
+{
+    return true;
+}
+
 // must come first
 template<
     class R0,
@@ -62,15 +103,22 @@ parse_variant(
             typename R0::value_type,
             typename Rn::value_type...>>
 {
-    auto const it0 = it;
-    auto rv = parse(
-        it, end, get<I>(rn));
-    if( rv )
-        return variant2::variant<
-            typename R0::value_type,
-            typename Rn::value_type...>{
-                variant2::in_place_index_t<I>{}, *rv};
-    it = it0;
+    using R = mp11::mp_at_c<
+        mp11::mp_list<R0, Rn...>, I>;
+    if(maybe_match(
+        get<I>(rn), it, end,
+        has_first_chars<R>{}))
+    {
+        auto const it0 = it;
+        auto rv = parse(
+            it, end, get<I>(rn));
+        if( rv )
+            return variant2::variant<
+                typename R0::value_type,
+                typename Rn::value_type...>{
+                    variant2::in_place_index_t<I>{}, *rv};
+        it = it0;
+    }
     return parse_variant(
         it, end, rn,
         std::integral_constant<
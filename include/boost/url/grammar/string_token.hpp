@@ -13,6 +13,8 @@
 #include <boost/url/detail/config.hpp>
 #include <boost/core/detail/string_view.hpp>
 #include <boost/url/detail/except.hpp>
+#include <boost/url/error_types.hpp>
+#include <cstring>
 #include <memory>
 #include <string>
 
@@ -223,6 +225,8 @@ using is_token = implementation_defined::is_token<T>;
     @li @ref return_string
     @li @ref assign_to
     @li @ref preserve_size
+    @li @ref in_arena
+    @li @ref write_to
 
  */
 template <class T>
@@ -461,6 +465,308 @@ preserve_size(
 {
     return implementation_defined::preserve_size_t<Alloc>(s);
 }
+
+//------------------------------------------------
+
+/** A monotonic buffer for string tokens
+
+    Objects of this type hand out character
+    buffers to string tokens created with
+    @ref in_arena. Memory is taken from an
+    optional buffer supplied by the caller,
+    and then from blocks allocated on the
+    heap whose sizes grow geometrically.
+    Nothing is freed until @ref release is
+    called or the arena is destroyed, so
+    strings obtained from the arena remain
+    valid until then.
+
+    An arena which is reused, for example
+    once per request, stops allocating when
+    its blocks are large enough to hold
+    every string produced in one use.
+
+    @par Example
+    @code
+    char buf[ 1024 ];
+    string_token::arena a( buf, sizeof( buf ) );
+    for( auto p : u.encoded_params() )
+    {
+        core::string_view v = p.value.decode( {}, string_token::in_arena( a ) );
+        // ...
+    }
+    a.release();
+    @endcode
+
+    @see
+        @ref in_arena.
+*/
+class BOOST_URL_DECL arena
+{
+    struct block;
+
+    char* p_ = nullptr;
+    char* end_ = nullptr;
+    char* buf_ = nullptr;
+    std::size_t buf_size_ = 0;
+    block* head_ = nullptr;
+    block* free_ = nullptr;
+    std::size_t used_ = 0;
+    std::size_t grow_ = 0;
+
+public:
+    /** Destructor
+
+        All memory allocated by the arena is freed.
+    */
+    ~arena();
+
+    /** Constructor
+
+        Default constructed arenas allocate every
+        buffer from the heap.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    arena() noexcept;
+
+    /** Constructor
+
+        The arena hands out buffers from `buf`
+        before allocating from the heap. The
+        caller is responsible for ensuring that
+        the buffer outlives the arena.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param buf The initial buffer.
+
+        @param size The size of the initial buffer.
+    */
+    arena(
+        char* buf,
+        std::size_t size) noexcept;
+
+    /// Deleted copy constructor
+    arena(arena const&) = delete;
+
+    /// Deleted copy assignment
+    arena& operator=(arena const&) = delete;
+
+    /** Return a buffer of `n` characters
+
+        The returned buffer has no alignment
+        requirements, and remains valid until
+        @ref release is called or the arena is
+        destroyed.
+
+        @par Complexity
+        Constant, amortized.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param n The number of characters.
+    */
+    char*
+    allocate(std::size_t n)
+    {
+        if(static_cast<std::size_t>(
+                end_ - p_) < n)
+            return allocate_slow(n);
+        char* p = p_;
+        p_ += n;
+        used_ += n;
+        return p;
+    }
+
+    /** Return the number of characters handed out
+
+        This is the total size of the buffers
+        returned by @ref allocate since the arena
+        was constructed or last released.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    used() const noexcept
+    {
+        return used_;
+    }
+
+    /** Release all buffers
+
+        Buffers previously returned by
+        @ref allocate become invalid. If a
+        single heap block was used it is kept,
+        and otherwise the next block allocated
+        is large enough for all of them, so
+        that an arena used repeatedly for a
+        similar workload stops allocating.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    void
+    release() noexcept;
+
+private:
+    char*
+    allocate_slow(std::size_t n);
+};
+
+//------------------------------------------------
+
+namespace implementation_defined {
+struct in_arena_t
+    : arg
+{
+    using result_type = core::string_view;
+
+    explicit
+    in_arena_t(
+        arena& a) noexcept
+        : a_(a)
+    {
+    }
+
+    char*
+    prepare(std::size_t n) override
+    {
+        p_ = a_.allocate(n);
+        n_ = n;
+        return p_;
+    }
+
+    result_type
+    result() noexcept
+    {
+        return core::string_view(p_, n_);
+    }
+
+private:
+    arena& a_;
+    char* p_ = nullptr;
+    std::size_t n_ = 0;
+};
+} // implementation_defined
+
+/** Create a string token for a string held in an arena
+
+    This function creates a @ref StringToken
+    which obtains its buffer from an @ref arena.
+
+    Functions using this token will write the
+    result to a buffer owned by the arena and
+    return a `core::string_view` to it, which
+    remains valid until the arena is released
+    or destroyed.
+
+    @par Example
+    @code
+    string_token::arena a;
+    core::string_view s = u.path( string_token::in_arena( a ) );
+    @endcode
+
+    @see
+        @ref arena.
+ */
+inline
+implementation_defined::in_arena_t
+in_arena(arena& a) noexcept
+{
+    return implementation_defined::in_arena_t(a);
+}
+
+//------------------------------------------------
+
+namespace implementation_defined {
+struct write_to_t
+    : arg
+{
+    using result_type =
+        system::result<core::string_view>;
+
+    write_to_t(
+        char* dest,
+        std::size_t size) noexcept
+        : dest_(dest)
+        , size_(size)
+    {
+    }
+
+    char*
+    prepare(std::size_t n) override
+    {
+        n_ = n;
+        if(n <= size_)
+            return dest_;
+        // the result does not fit; it is
+        // written to a temporary and then
+        // truncated by result()
+        over_.resize(n);
+        return &over_[0];
+    }
+
+    result_type
+    result() noexcept
+    {
+        if(n_ <= size_)
+            return core::string_view(dest_, n_);
+        std::memcpy(dest_,
+            over_.data(), size_);
+        BOOST_URL_RETURN_EC(
+            system::errc::make_error_code(
+                system::errc::value_too_large));
+    }
+
+private:
+    char* dest_;
+    std::size_t size_;
+    std::size_t n_ = 0;
+    std::string over_;
+};
+} // implementation_defined
+
+/** Create a string token for writing to a caller buffer
+
+    This function creates a @ref StringToken
+    which writes to a character buffer supplied
+    by the caller, without allocating memory.
+
+    Functions using this token return a
+    `system::result` holding a
+    `core::string_view` to the characters
+    written to the buffer. If the result does
+    not fit, the buffer is filled with as
+    much of it as fits, and the error
+    `errc::value_too_large` is returned
+    instead; only in this case is memory
+    allocated, to hold the full result
+    temporarily.
+
+    @par Example
+    @code
+    char buf[ 256 ];
+    system::result< core::string_view > rv = u.path( string_token::write_to( buf, sizeof( buf ) ) );
+    @endcode
+
+    @param dest The buffer to write to.
+
+    @param size The size of the buffer.
+ */
+inline
+implementation_defined::write_to_t
+write_to(
+    char* dest,
+    std::size_t size) noexcept
+{
+    return implementation_defined::write_to_t(
+        dest, size);
+}
 } // string_token
 
 namespace grammar {
@@ -0,0 +1,118 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_GRAMMAR_TELEMETRY_HPP
+#define BOOST_URL_GRAMMAR_TELEMETRY_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+namespace grammar {
+
+/** The counters of one rule
+
+    An object of this type holds the
+    counters of a rule passed to @ref parse,
+    as returned by @ref telemetry_snapshot.
+
+    @see
+        @ref telemetry_snapshot.
+*/
+struct rule_telemetry
+{
+    /** The number of failure buckets
+    */
+    static constexpr std::size_t error_buckets = 8;
+
+    /** The name of the type of the rule
+    */
+    std::string name;
+
+    /** The number of times the rule was used
+    */
+    std::uint64_t calls = 0;
+
+    /** The number of times the rule failed
+    */
+    std::uint64_t failures = 0;
+
+    /** The number of characters consumed by successful uses
+    */
+    std::uint64_t bytes = 0;
+
+    /** The number of failures by error code
+
+        The element at index `i`, for `i > 0`,
+        counts failures with the code
+        `static_cast<error>( i )`. The element at
+        index 0 counts failures with a code
+        which is not a @ref error.
+    */
+    std::uint64_t errors[error_buckets] = {};
+};
+
+/** Return the counters of every rule used with parse
+
+    When the library and the program are
+    compiled with the macro
+    `BOOST_URL_ENABLE_TELEMETRY` defined,
+    each call to @ref parse counts the use of
+    its rule, whether it failed and with
+    which error, and the number of characters
+    it consumed. This function returns a copy
+    of the counters of every rule used so
+    far, sorted by name. Otherwise, which is
+    the default, @ref parse counts nothing
+    and the returned vector is empty.
+
+    The counters are read without locks, while
+    other threads may be parsing, so that the
+    counters of a rule may be from slightly
+    different moments.
+
+    @par Example
+    @code
+    for( auto const& t : telemetry_snapshot() )
+        std::cout << t.name << ": " << t.failures << " of " << t.calls << "\n";
+    @endcode
+
+    @par Exception Safety
+    Calls to allocate may throw.
+
+    @see
+        @ref rule_telemetry,
+        @ref telemetry_reset.
+*/
+BOOST_URL_DECL
+std::vector<rule_telemetry>
+telemetry_snapshot();
+
+/** Set the counters of every rule to zero
+
+    @par Exception Safety
+    Throws nothing.
+
+    @see
+        @ref telemetry_snapshot.
+*/
+BOOST_URL_DECL
+void
+telemetry_reset() noexcept;
+
+} // grammar
+} // urls
+} // boost
+
+#endif
@@ -61,6 +61,15 @@ public:
         char const*& it,
         char const* end) const;
 
+    template<class R = R0>
+    auto
+    first_chars(char c) const noexcept ->
+        decltype(std::declval<
+            R const&>().first_chars(c))
+    {
+        return detail::get<0>(
+            this->get()).first_chars(c);
+    }
 };
 } // implementation_defined
 
@@ -163,6 +172,15 @@ struct squelch_rule_t
             return rv.error();
         return {}; // void
     }
+
+    template<class R = Rule>
+    auto
+    first_chars(char c) const noexcept ->
+        decltype(std::declval<
+            R const&>().first_chars(c))
+    {
+        return this->get().first_chars(c);
+    }
 };
 
 } // implementation_defined
@@ -96,6 +96,14 @@ struct unsigned_rule
         char const* end
             ) const noexcept ->
         system::result<value_type>;
+
+    static
+    constexpr
+    bool
+    first_chars(char c) noexcept
+    {
+        return c >= '0' && c <= '9';
+    }
 };
 #endif
 
@@ -57,6 +57,17 @@ private:
     is stored and returned in the variant. If
     no match occurs, an error is returned.
 
+    A rule may declare the characters which
+    can begin a match by providing a member
+    `first_chars`, invocable with a `char` and
+    returning `bool`, such as a @ref CharSet.
+    Such a rule must fail when the input is
+    empty or when `first_chars` returns `false`
+    for the first character. A rule which
+    declares `first_chars` is skipped without
+    being invoked when it cannot match the
+    input, avoiding a partial parse.
+
     @par Value Type
     @code
     using value_type = variant< typename Rules::value_type... >;
@@ -79,6 +90,24 @@ private:
             delim_rule('*') ) );
     @endcode
 
+    @par Example
+    A rule which declares its first characters:
+    @code
+    struct flag_rule_t
+    {
+        using value_type = core::string_view;
+
+        system::result< value_type >
+        parse( char const*& it, char const* end ) const noexcept;
+
+        // a flag always starts with a dash
+        static constexpr bool first_chars( char c ) noexcept
+        {
+            return c == '-';
+        }
+    };
+    @endcode
+
     @par BNF
     @code
     variant     = rule1 / rule2 / rule3...
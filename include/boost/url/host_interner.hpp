@@ -0,0 +1,205 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_HOST_INTERNER_HPP
+#define BOOST_URL_HOST_INTERNER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/optional.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace boost {
+namespace urls {
+
+/** A dictionary which maps hosts to dense ids
+
+    This container assigns each distinct host
+    a 32-bit id, numbered consecutively from
+    zero in the order the hosts are first
+    interned. A collection of urls may then
+    store the id of its host instead of the
+    characters, as @ref compact_url does.
+
+    Hosts are given as returned by
+    `encoded_host()`, and are normalized
+    before they are stored, so that hosts
+    have the same id exactly when they are
+    equal in @ref url_view_base::compare: an
+    IPv6 address is written in its canonical
+    form, and a registered name is decoded
+    and converted to lower case, then encoded
+    again where required, with upper case
+    hexadecimal digits.
+
+    The dictionary is divided into shards, each
+    with its own lock, which is taken only to
+    add a host. Looking up the id for a host
+    with @ref find, and the host for an id
+    with @ref host, take no lock and read
+    storage which never moves once written.
+
+    @par Example
+    @code
+    host_interner hi;
+    auto id = hi.intern( url_view( "https://WWW.Example.com/" ).encoded_host() );
+
+    assert( hi.intern( "www.example.com" ) == id );
+    assert( hi.host( id ) == "www.example.com" );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.
+    Shared objects: Safe.
+    When the library is built with
+    `BOOST_URL_DISABLE_THREADS`, shards
+    have no locks and shared objects
+    are unsafe.
+
+    @see
+        @ref compact_url.
+*/
+class BOOST_URL_DECL host_interner
+{
+    struct shard;
+    struct ids;
+    struct entry
+    {
+        char const* data;
+        std::size_t size;
+    };
+
+    // segment i holds 1024 << i entries
+    static constexpr std::size_t segments = 23;
+
+    std::unique_ptr<shard[]> shards_;
+    std::unique_ptr<ids> ids_;
+    std::size_t shard_mask_ = 0;
+    std::atomic<entry*> segs_[segments];
+    std::atomic<std::uint32_t> size_{0};
+
+    entry* segment(std::uint32_t id);
+    entry const* find_entry(
+        std::uint32_t id) const noexcept;
+
+public:
+    /** Destructor
+    */
+    ~host_interner();
+
+    /** Constructor
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `shards == 0`.
+
+        @param shards The number of shards,
+        which is rounded up to a power of two.
+    */
+    explicit
+    host_interner(
+        std::size_t shards = 64);
+
+    host_interner(
+        host_interner const&) = delete;
+    host_interner& operator=(
+        host_interner const&) = delete;
+
+    /** Return the id of a host, adding it if necessary
+
+        @par Complexity
+        Linear in `s.size()`, amortized.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        The number of hosts would exceed
+        `0xffffffff`.
+
+        @return The id.
+
+        @param s The encoded host.
+    */
+    std::uint32_t
+    intern(core::string_view s);
+
+    /** Return the id of a host if it is present
+
+        No lock is taken. A host interned by
+        another thread during the call may or
+        may not be found.
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The id, or an empty optional
+        if the host was never interned.
+
+        @param s The encoded host.
+    */
+    boost::optional<std::uint32_t>
+    find(core::string_view s) const noexcept;
+
+    /** Return the host with the given id
+
+        The host is returned in its normalized
+        form. No lock is taken.
+
+        @par Preconditions
+        `id` was returned by @ref intern or
+        @ref find on this object.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param id The host id.
+    */
+    core::string_view
+    host(std::uint32_t id) const noexcept;
+
+    /** Return the number of hosts
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return size_.load(
+            std::memory_order_acquire);
+    }
+
+    /** Return the number of bytes of memory used
+
+        @par Exception Safety
+        Exceptions thrown on failure to lock.
+
+        @throw std::system_error
+        A shard could not be locked.
+    */
+    std::size_t
+    memory_usage() const;
+};
+
+} // urls
+} // boost
+
+#endif
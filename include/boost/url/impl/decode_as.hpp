@@ -0,0 +1,191 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_DECODE_AS_HPP
+#define BOOST_URL_IMPL_DECODE_AS_HPP
+
+#include <boost/url/grammar/error.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/unsigned_rule.hpp>
+#include <boost/static_assert.hpp>
+#include <limits>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Large enough for any integer, and
+// for any reasonably written float
+constexpr std::size_t decode_as_max_size = 128;
+
+// Returns s when it has no escapes,
+// otherwise decodes s into dest.
+BOOST_URL_DECL
+system::result<core::string_view>
+decode_as_chars(
+    pct_string_view s,
+    encoding_opts opt,
+    char* dest,
+    std::size_t n) noexcept;
+
+BOOST_URL_DECL
+system::result<bool>
+decode_as_bool(
+    pct_string_view s,
+    encoding_opts opt) noexcept;
+
+BOOST_URL_DECL
+system::result<float>
+decode_as_float(
+    pct_string_view s,
+    encoding_opts opt,
+    float*) noexcept;
+
+BOOST_URL_DECL
+system::result<double>
+decode_as_float(
+    pct_string_view s,
+    encoding_opts opt,
+    double*) noexcept;
+
+BOOST_URL_DECL
+system::result<long double>
+decode_as_float(
+    pct_string_view s,
+    encoding_opts opt,
+    long double*) noexcept;
+
+// unsigned_rule fails with invalid both
+// for a leading zero and for an overflow,
+// which is reported as out_of_range.
+template<class U>
+system::result<U>
+decode_as_unsigned(
+    core::string_view d) noexcept
+{
+    auto rv = grammar::parse(
+        d, grammar::unsigned_rule<U>{});
+    if( rv.has_error() &&
+        rv.error() == grammar::error::invalid &&
+        d.front() != '0')
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::out_of_range);
+    }
+    return rv;
+}
+
+template<class T>
+using decode_as_kind = std::integral_constant<int,
+    std::is_same<T, bool>::value ? 0 :
+    std::is_floating_point<T>::value ? 1 :
+    std::is_signed<T>::value ? 2 : 3>;
+
+template<class T>
+system::result<T>
+decode_as_impl(
+    pct_string_view s,
+    encoding_opts opt,
+    std::integral_constant<int, 0>) noexcept
+{
+    return decode_as_bool(s, opt);
+}
+
+template<class T>
+system::result<T>
+decode_as_impl(
+    pct_string_view s,
+    encoding_opts opt,
+    std::integral_constant<int, 1>) noexcept
+{
+    return decode_as_float(
+        s, opt, static_cast<T*>(nullptr));
+}
+
+template<class T>
+system::result<T>
+decode_as_impl(
+    pct_string_view s,
+    encoding_opts opt,
+    std::integral_constant<int, 2>) noexcept
+{
+    using U = typename
+        std::make_unsigned<T>::type;
+    char buf[decode_as_max_size];
+    auto rv = decode_as_chars(
+        s, opt, buf, sizeof(buf));
+    if(! rv)
+        return rv.error();
+    core::string_view d = *rv;
+    bool neg = false;
+    if( ! d.empty() &&
+        (d.front() == '-' ||
+         d.front() == '+'))
+    {
+        neg = d.front() == '-';
+        d.remove_prefix(1);
+    }
+    auto ru = decode_as_unsigned<U>(d);
+    if(! ru)
+        return ru.error();
+    U const max = static_cast<U>(
+        (std::numeric_limits<T>::max)());
+    if(! neg)
+    {
+        if(*ru > max)
+        {
+            BOOST_URL_RETURN_EC(
+                grammar::error::out_of_range);
+        }
+        return static_cast<T>(*ru);
+    }
+    if(*ru > static_cast<U>(max + 1u))
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::out_of_range);
+    }
+    if(*ru == static_cast<U>(max + 1u))
+        return (std::numeric_limits<T>::min)();
+    return static_cast<T>(
+        -static_cast<T>(*ru));
+}
+
+template<class T>
+system::result<T>
+decode_as_impl(
+    pct_string_view s,
+    encoding_opts opt,
+    std::integral_constant<int, 3>) noexcept
+{
+    char buf[decode_as_max_size];
+    auto rv = decode_as_chars(
+        s, opt, buf, sizeof(buf));
+    if(! rv)
+        return rv.error();
+    return decode_as_unsigned<T>(*rv);
+}
+
+} // detail
+
+template<class T>
+system::result<T>
+decode_as(
+    pct_string_view s,
+    encoding_opts opt) noexcept
+{
+    BOOST_STATIC_ASSERT(
+        std::is_arithmetic<T>::value);
+    return detail::decode_as_impl<T>(
+        s, opt, detail::decode_as_kind<T>{});
+}
+
+} // urls
+} // boost
+
+#endif
@@ -109,6 +109,34 @@ public:
     }
 };
 
+//------------------------------------------------
+
+template<class T>
+system::result<T>
+params_base::
+get_as(
+    core::string_view key,
+    ignore_case_param ic) const noexcept
+{
+    detail::params_iter_impl const it =
+        find_impl(begin().it_, key, ic);
+    if(it.equal(end().it_))
+    {
+        // no matching key
+        BOOST_URL_RETURN_EC(
+            grammar::error::mismatch);
+    }
+    param_pct_view const p =
+        it.dereference();
+    if(! p.has_value)
+    {
+        // no value
+        BOOST_URL_RETURN_EC(
+            grammar::error::mismatch);
+    }
+    return decode_as<T>(
+        p.value, opt_);
+}
 
 } // urls
 } // boost
@@ -180,6 +180,33 @@ find_last(
         it.it_, key, ic);
 }
 
+template<class T>
+system::result<T>
+params_encoded_base::
+get_as(
+    pct_string_view key,
+    ignore_case_param ic) const noexcept
+{
+    detail::params_iter_impl const it =
+        find_impl(begin().it_, key, ic);
+    if(it.equal(end().it_))
+    {
+        // no matching key
+        BOOST_URL_RETURN_EC(
+            grammar::error::mismatch);
+    }
+    param_pct_view const p =
+        it.dereference();
+    if(! p.has_value)
+    {
+        // no value
+        BOOST_URL_RETURN_EC(
+            grammar::error::mismatch);
+    }
+    return decode_as<T>(
+        p.value);
+}
+
 } // urls
 } // boost
 
@@ -0,0 +1,244 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_PARAMS_ENCODED_INDEX_HPP
+#define BOOST_URL_IMPL_PARAMS_ENCODED_INDEX_HPP
+
+#include <boost/assert.hpp>
+#include <iterator>
+
+namespace boost {
+namespace urls {
+
+class params_encoded_index::iterator
+{
+    params_encoded_index const* idx_ = nullptr;
+    std::size_t i_ = 0;
+
+    friend class params_encoded_index;
+
+    iterator(
+        params_encoded_index const& idx,
+        std::size_t i) noexcept
+        : idx_(&idx)
+        , i_(i)
+    {
+    }
+
+public:
+    using value_type =
+        params_encoded_index::value_type;
+    using reference =
+        params_encoded_index::reference;
+    using pointer = reference;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::random_access_iterator_tag;
+
+    iterator() = default;
+    iterator(iterator const&) = default;
+    iterator& operator=(
+        iterator const&) = default;
+
+    reference
+    operator*() const noexcept
+    {
+        return idx_->get(i_);
+    }
+
+    pointer
+    operator->() const noexcept
+    {
+        return idx_->get(i_);
+    }
+
+    reference
+    operator[](difference_type n) const noexcept
+    {
+        return idx_->get(i_ + n);
+    }
+
+    iterator&
+    operator++() noexcept
+    {
+        ++i_;
+        return *this;
+    }
+
+    iterator&
+    operator--() noexcept
+    {
+        BOOST_ASSERT(i_ != 0);
+        --i_;
+        return *this;
+    }
+
+    iterator
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    iterator
+    operator--(int) noexcept
+    {
+        auto tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    iterator&
+    operator+=(difference_type n) noexcept
+    {
+        i_ += n;
+        return *this;
+    }
+
+    iterator&
+    operator-=(difference_type n) noexcept
+    {
+        i_ -= n;
+        return *this;
+    }
+
+    friend
+    iterator
+    operator+(
+        iterator it,
+        difference_type n) noexcept
+    {
+        return it += n;
+    }
+
+    friend
+    iterator
+    operator+(
+        difference_type n,
+        iterator it) noexcept
+    {
+        return it += n;
+    }
+
+    friend
+    iterator
+    operator-(
+        iterator it,
+        difference_type n) noexcept
+    {
+        return it -= n;
+    }
+
+    friend
+    difference_type
+    operator-(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        BOOST_ASSERT(a.idx_ == b.idx_);
+        return static_cast<difference_type>(a.i_) -
+            static_cast<difference_type>(b.i_);
+    }
+
+    bool
+    operator==(
+        iterator const& other) const noexcept
+    {
+        BOOST_ASSERT(idx_ == other.idx_);
+        return i_ == other.i_;
+    }
+
+    bool
+    operator!=(
+        iterator const& other) const noexcept
+    {
+        return ! (*this == other);
+    }
+
+    bool
+    operator<(
+        iterator const& other) const noexcept
+    {
+        BOOST_ASSERT(idx_ == other.idx_);
+        return i_ < other.i_;
+    }
+
+    bool
+    operator>(
+        iterator const& other) const noexcept
+    {
+        return other < *this;
+    }
+
+    bool
+    operator<=(
+        iterator const& other) const noexcept
+    {
+        return ! (other < *this);
+    }
+
+    bool
+    operator>=(
+        iterator const& other) const noexcept
+    {
+        return ! (*this < other);
+    }
+};
+
+//------------------------------------------------
+
+inline
+auto
+params_encoded_index::
+begin() const noexcept ->
+    iterator
+{
+    return iterator(*this, 0);
+}
+
+inline
+auto
+params_encoded_index::
+end() const noexcept ->
+    iterator
+{
+    return iterator(*this, pos_.size());
+}
+
+inline
+param_pct_view
+params_encoded_index::
+operator[](std::size_t i) const noexcept
+{
+    return get(i);
+}
+
+inline
+param_pct_view
+params_encoded_index::
+front() const noexcept
+{
+    BOOST_ASSERT(! empty());
+    return get(0);
+}
+
+inline
+param_pct_view
+params_encoded_index::
+back() const noexcept
+{
+    BOOST_ASSERT(! empty());
+    return get(pos_.size() - 1);
+}
+
+} // urls
+} // boost
+
+#endif
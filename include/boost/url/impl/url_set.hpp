@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_URL_SET_HPP
+#define BOOST_URL_IMPL_URL_SET_HPP
+
+#include <boost/url/detail/url_impl.hpp>
+#include <cstddef>
+#include <iterator>
+
+namespace boost {
+namespace urls {
+
+class url_set::iterator
+{
+    url_set const* set_ = nullptr;
+    std::size_t pos_ = 0;
+    std::size_t next_ = 0;
+    std::string buf_;
+    detail::url_impl impl_{
+        detail::url_impl::from::string};
+
+    friend class url_set;
+
+    iterator(
+        url_set const& set,
+        std::size_t pos)
+        : set_(&set)
+        , pos_(pos)
+    {
+        read();
+    }
+
+    BOOST_URL_DECL
+    void
+    read();
+
+public:
+    using value_type = url_view;
+    using reference = url_view;
+    using pointer = void const*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::input_iterator_tag;
+
+    iterator() = default;
+
+    /** Return the url at this position
+
+        The returned view references storage
+        owned by the iterator.
+    */
+    BOOST_URL_DECL
+    reference
+    operator*() const noexcept;
+
+    // the return value is too expensive
+    pointer operator->() const = delete;
+
+    iterator&
+    operator++()
+    {
+        pos_ = next_;
+        read();
+        return *this;
+    }
+
+    iterator
+    operator++(int)
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    bool
+    operator==(
+        iterator const& other) const noexcept
+    {
+        return pos_ == other.pos_;
+    }
+
+    bool
+    operator!=(
+        iterator const& other) const noexcept
+    {
+        return pos_ != other.pos_;
+    }
+};
+
+//------------------------------------------------
+
+template<class FwdIt>
+url_set::
+url_set(
+    FwdIt first,
+    FwdIt last)
+{
+    for(; first != last; ++first)
+    {
+        url_view_base const& u = *first;
+        append(u);
+    }
+    finish();
+}
+
+} // urls
+} // boost
+
+#endif
@@ -183,6 +183,13 @@ public:
         The returned string does not
         contain surrounding square brackets.
 
+        The text is in the canonical form: hex
+        digits are lowercase without leading
+        zeroes, the first longest run of two or
+        more zero words is replaced with "::",
+        and IPv4-mapped addresses end in dotted
+        decimal.
+
         When called with no arguments, the
         return type is `std::string`.
         Otherwise, the return type and style
@@ -218,6 +225,8 @@ public:
         @par Specification
         @li <a href="https://datatracker.ietf.org/doc/html/rfc4291#section-2.2">
             2.2. Text Representation of Addresses (rfc4291)</a>
+        @li <a href="https://datatracker.ietf.org/doc/html/rfc5952#section-4">
+            4. A Recommendation for IPv6 Text Representation (rfc5952)</a>
     */
     template<BOOST_URL_STRTOK_TPARAM>
     BOOST_URL_STRTOK_RETURN
@@ -403,6 +412,106 @@ system::result<ipv6_address>
 parse_ipv6_address(
     core::string_view s) noexcept;
 
+/** Parse an array of strings containing IPv6 addresses.
+
+    This function parses each string in the
+    range `[src, src + n)` as an IPv6 address
+    and stores the result in the corresponding
+    element of `dest`. Conversion stops at the
+    first string which does not contain a valid
+    IPv6 address; the error may be obtained by
+    calling @ref parse_ipv6_address on it.
+
+    @par Example
+    @code
+    core::string_view s[2] = { "::1", "2001:db8::" };
+    ipv6_address a[2];
+    assert( parse_ipv6_addresses( s, 2, a ) == 2 );
+    @endcode
+
+    @par Complexity
+    Linear in the total size of the strings.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return The number of addresses stored,
+    which is less than `n` if a string was
+    invalid.
+
+    @param src A pointer to the strings.
+
+    @param n The number of strings.
+
+    @param dest A pointer to at least
+    `n` addresses.
+
+    @see
+        @ref parse_ipv6_address,
+        @ref print_ipv6_addresses.
+*/
+BOOST_URL_DECL
+std::size_t
+parse_ipv6_addresses(
+    core::string_view const* src,
+    std::size_t n,
+    ipv6_address* dest) noexcept;
+
+/** Format an array of IPv6 addresses.
+
+    This function writes the text of each
+    address in the range `[src, src + n)`
+    to `dest`, back to back and without
+    separators, and stores the size of each
+    text in the corresponding element of
+    `sizes`. Output stops at the first
+    address which does not fit in the
+    remaining space.
+    The text is the same as that returned
+    by @ref ipv6_address::to_string.
+
+    @par Example
+    @code
+    ipv6_address a[2] = { ipv6_address::loopback(), ipv6_address() };
+    char buf[ 2 * ipv6_address::max_str_len ];
+    std::size_t sizes[2];
+    assert( print_ipv6_addresses( a, 2, buf, sizeof(buf), sizes ) == 2 );
+    assert( core::string_view( buf, sizes[0] + sizes[1] ) == "::1::" );
+    @endcode
+
+    @par Complexity
+    Linear in `n`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return The number of addresses written.
+
+    @param src A pointer to the addresses.
+
+    @param n The number of addresses.
+
+    @param dest The buffer to write to.
+
+    @param size The number of writable bytes
+    pointed to by `dest`.
+
+    @param sizes A pointer to at least `n`
+    sizes.
+
+    @see
+        @ref ipv6_address::to_buffer,
+        @ref parse_ipv6_addresses.
+*/
+BOOST_URL_DECL
+std::size_t
+print_ipv6_addresses(
+    ipv6_address const* src,
+    std::size_t n,
+    char* dest,
+    std::size_t size,
+    std::size_t* sizes) noexcept;
+
 } // urls
 } // boost
 
@@ -0,0 +1,190 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_MOUNT_TABLE_HPP
+#define BOOST_URL_MOUNT_TABLE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/segments_encoded_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/optional.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A table of path prefixes matched by longest prefix
+
+    This container holds a set of mount
+    points, each a path prefix identified by
+    the id returned when it is added. Given a
+    path, the table finds the mount point with
+    the longest prefix of the path, comparing
+    whole segments after decoding
+    percent-escapes, and the segments of the
+    path which follow the prefix.
+
+    The prefixes are stored in a trie whose
+    edges are the decoded segments, and the
+    children of all the nodes are found in one
+    hash table, so that a path is matched in
+    one descent, in time proportional to its
+    size, regardless of the number of mount
+    points. No memory is allocated to match.
+
+    A trailing slash in a prefix is ignored.
+    The prefix "/" has no segments, and
+    matches every path.
+
+    @par Example
+    @code
+    mount_table mt;
+    auto id0 = mt.add( "/" );
+    auto id1 = mt.add( "/static/img" );
+
+    url_view u( "/static/img/logo%20big.png" );
+    auto m = mt.find( u.encoded_segments() );
+
+    assert( m && m->id == id1 );
+    assert( *m->first == "logo%20big.png" && std::next( m->first ) == m->last );
+    assert( mt.find( url_view( "/static/css/site.css" ).encoded_segments() )->id == id0 );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.
+    Shared objects: Unsafe.
+    Calls to const member functions on a
+    shared object are safe.
+*/
+class BOOST_URL_DECL mount_table
+{
+    struct node
+    {
+        std::uint32_t parent;
+        std::uint32_t label;
+        std::uint32_t size;
+        std::uint32_t hash;
+        std::uint32_t mount;
+    };
+
+    std::vector<node> nodes_;
+    std::vector<std::uint32_t> slots_;
+    std::string labels_;
+    std::size_t size_ = 0;
+
+    std::uint32_t find_child(
+        std::uint32_t parent,
+        core::string_view label) const noexcept;
+    std::uint32_t new_node(
+        std::uint32_t parent,
+        core::string_view label);
+    void grow();
+
+public:
+    /** The result of a match
+    */
+    struct match
+    {
+        /** The id of the mount point
+        */
+        std::size_t id;
+
+        /** The first segment after the prefix
+        */
+        segments_encoded_view::iterator first;
+
+        /** One past the last segment of the path
+        */
+        segments_encoded_view::iterator last;
+    };
+
+    /** Constructor
+
+        Default constructed tables have
+        no mount points.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+    */
+    mount_table();
+
+    /** Return the number of mount points
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    /** Add a mount point
+
+        If a mount point with the same
+        segments exists, its id is returned
+        and no mount point is added.
+
+        @par Complexity
+        Linear in `prefix.size()`, amortized.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `prefix` is not a valid path, or the
+        table is full.
+
+        @return The id of the mount point.
+
+        @param prefix The encoded path prefix.
+    */
+    std::size_t
+    add(core::string_view prefix);
+
+    /** Return the mount point with the longest prefix of a path
+
+        The returned iterators denote the
+        segments of `path` after the prefix,
+        and remain valid as long as the
+        characters of `path`.
+
+        @par Complexity
+        Linear in the size of the path.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The match, or an empty
+        optional if no mount point is a
+        prefix of the path.
+
+        @param path The segments to match.
+    */
+    boost::optional<match>
+    find(segments_encoded_view path) const noexcept;
+
+    /** Return the number of bytes of memory used
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    memory_usage() const noexcept;
+};
+
+} // urls
+} // boost
+
+#endif
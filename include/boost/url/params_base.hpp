@@ -12,6 +12,7 @@
 #define BOOST_URL_PARAMS_BASE_HPP
 
 #include <boost/url/detail/config.hpp>
+#include <boost/url/decode_as.hpp>
 #include <boost/url/encoding_opts.hpp>
 #include <boost/url/ignore_case.hpp>
 #include <boost/url/param.hpp>
@@ -479,6 +480,58 @@ public:
         core::string_view key,
         ignore_case_param ic = {}) const noexcept;
 
+    //--------------------------------------------
+
+    /** Return the value of a matching key as an arithmetic type
+
+        This function finds the first param
+        matching the specified key, and converts
+        its value to type `T` as if by calling
+        @ref decode_as. Percent-escapes in the
+        value are decoded as the value is
+        converted; no memory is allocated.
+
+        @par Example
+        @code
+        url_view u( "?limit=50&offset=1000" );
+
+        system::result< std::size_t > rv = u.params().get_as< std::size_t >( "limit" );
+
+        assert( rv.value() == 50 );
+        @endcode
+
+        @par Complexity
+        Linear in `this->buffer().size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The converted value, or an error
+        code. The error is @ref grammar::error::mismatch
+        if no param matches `key` or the matching
+        param has no value. Otherwise, the error
+        is one of those returned by @ref decode_as.
+
+        @param key The key to match.
+        By default, a case-sensitive
+        comparison is used.
+
+        @param ic An optional parameter. If
+        the value @ref ignore_case is passed
+        here, the comparison is
+        case-insensitive.
+
+        @tparam T The arithmetic type to convert to.
+
+        @see
+            @ref decode_as.
+    */
+    template<class T>
+    system::result<T>
+    get_as(
+        core::string_view key,
+        ignore_case_param ic = {}) const noexcept;
+
 private:
     detail::params_iter_impl
     find_impl(
@@ -12,6 +12,7 @@
 #define BOOST_URL_PARAMS_ENCODED_BASE_HPP
 
 #include <boost/url/detail/config.hpp>
+#include <boost/url/decode_as.hpp>
 #include <boost/url/ignore_case.hpp>
 #include <boost/url/param.hpp>
 #include <boost/url/detail/params_iter_impl.hpp>
@@ -38,6 +39,7 @@ namespace urls {
 class BOOST_URL_DECL params_encoded_base
 {
     friend class url_view_base;
+    friend class params_encoded_index;
     friend class params_encoded_ref;
     friend class params_encoded_view;
 
@@ -529,6 +531,61 @@ public:
         pct_string_view key,
         ignore_case_param ic = {}) const noexcept;
 
+    //--------------------------------------------
+
+    /** Return the value of a matching key as an arithmetic type
+
+        This function finds the first param
+        matching the specified key, and converts
+        its value to type `T` as if by calling
+        @ref decode_as. The key may contain
+        percent-escapes, and the comparison is
+        performed as if all escaped characters
+        were decoded first. Percent-escapes in
+        the value are decoded as the value is
+        converted; no memory is allocated.
+
+        @par Example
+        @code
+        url_view u( "?limit=50&offset=1000" );
+
+        system::result< std::size_t > rv = u.encoded_params().get_as< std::size_t >( "limit" );
+
+        assert( rv.value() == 50 );
+        @endcode
+
+        @par Complexity
+        Linear in `this->buffer().size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The converted value, or an error
+        code. The error is @ref grammar::error::mismatch
+        if no param matches `key` or the matching
+        param has no value. Otherwise, the error
+        is one of those returned by @ref decode_as.
+
+        @param key The key to match.
+        By default, a case-sensitive
+        comparison is used.
+
+        @param ic An optional parameter. If
+        the value @ref ignore_case is passed
+        here, the comparison is
+        case-insensitive.
+
+        @tparam T The arithmetic type to convert to.
+
+        @see
+            @ref decode_as.
+    */
+    template<class T>
+    system::result<T>
+    get_as(
+        pct_string_view key,
+        ignore_case_param ic = {}) const noexcept;
+
 private:
     detail::params_iter_impl
     find_impl(
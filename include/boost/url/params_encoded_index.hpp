@@ -0,0 +1,348 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_PARAMS_ENCODED_INDEX_HPP
+#define BOOST_URL_PARAMS_ENCODED_INDEX_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/param.hpp>
+#include <boost/url/params_encoded_view.hpp>
+#include <boost/url/detail/url_impl.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A random-access view of encoded query parameters
+
+    Objects of this type store the position
+    of every parameter in a query, so that
+    any parameter can be accessed in constant
+    time. The positions are computed once,
+    upon construction, from a
+    @ref params_encoded_view.
+
+    The index does not retain ownership of
+    the query and instead references the
+    original character buffer. The caller is
+    responsible for ensuring that the lifetime
+    of the buffer extends until it is no
+    longer referenced.
+
+    @par Example
+    @code
+    url_view u( "?first=John&last=Doe&age=42" );
+    params_encoded_index qp( u.encoded_params() );
+
+    assert( qp[2].value == "42" );
+    assert( (qp.begin() + 1)->key == "last" );
+    @endcode
+
+    @par Iterator Invalidation
+    Changes to the underlying character buffer
+    invalidate the index and all iterators
+    which reference it.
+
+    @see
+        @ref params_encoded_view,
+        @ref segments_encoded_index.
+*/
+class BOOST_URL_DECL params_encoded_index
+{
+    detail::query_ref ref_;
+    std::vector<std::size_t> pos_;
+
+public:
+    /** A Random Access iterator to a query parameter
+
+        Objects of this type allow random-access
+        iteration through the parameters in the
+        query. Strings returned by iterators may
+        contain percent escapes.
+    */
+    class iterator;
+
+    /// @copydoc iterator
+    using const_iterator = iterator;
+
+    /** The value type
+
+        Values of this type represent parameters
+        whose strings retain unique ownership by
+        making a copy.
+    */
+    using value_type = param;
+
+    /** The reference type
+
+        This is the type of value returned when
+        iterators of the view are dereferenced.
+    */
+    using reference = param_pct_view;
+
+    /// @copydoc reference
+    using const_reference = param_pct_view;
+
+    /** An unsigned integer type used to represent size.
+    */
+    using size_type = std::size_t;
+
+    /** A signed integer type used to represent differences.
+    */
+    using difference_type = std::ptrdiff_t;
+
+    //--------------------------------------------
+    //
+    // Special Members
+    //
+    //--------------------------------------------
+
+    /** Constructor
+
+        Default-constructed indexes have
+        zero elements.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    params_encoded_index() = default;
+
+    /** Constructor
+
+        This function computes the position of
+        every parameter in `qp`. Upon construction,
+        the index references the same character
+        buffer as `qp`.
+
+        @par Example
+        @code
+        params_encoded_index qp( parse_query( "first=John&last=Doe" ).value() );
+        @endcode
+
+        @par Postconditions
+        @code
+        this->buffer().data() == qp.buffer().data() && this->size() == qp.size()
+        @endcode
+
+        @par Complexity
+        Linear in `qp.buffer().size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param qp The params to index.
+    */
+    explicit
+    params_encoded_index(
+        params_encoded_view const& qp);
+
+    //--------------------------------------------
+    //
+    // Observers
+    //
+    //--------------------------------------------
+
+    /** Return the referenced character buffer.
+
+        This function returns the character
+        buffer referenced by the index.
+        The returned string may contain
+        percent escapes.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    pct_string_view
+    buffer() const noexcept
+    {
+        return ref_.buffer();
+    }
+
+    /** Return true if there are no params
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return pos_.empty();
+    }
+
+    /** Return the number of params
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return pos_.size();
+    }
+
+    /** Return an iterator to the beginning
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    begin() const noexcept;
+
+    /** Return an iterator to the end
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    end() const noexcept;
+
+    /** Return a param
+
+        @par Preconditions
+        @code
+        i < this->size()
+        @endcode
+
+        @par Complexity
+        Linear in the size of the param.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param i The zero-based index of
+        the param.
+    */
+    param_pct_view
+    operator[](std::size_t i) const noexcept;
+
+    /** Return the first param
+
+        @par Preconditions
+        @code
+        this->empty() == false
+        @endcode
+
+        @par Complexity
+        Linear in the size of the param.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    param_pct_view
+    front() const noexcept;
+
+    /** Return the last param
+
+        @par Preconditions
+        @code
+        this->empty() == false
+        @endcode
+
+        @par Complexity
+        Linear in the size of the param.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    param_pct_view
+    back() const noexcept;
+
+    /** Return the position of a param
+
+        This function returns the offset
+        into @ref buffer of the first
+        character of the key of the param at
+        index `i`. The offsets are strictly
+        increasing.
+
+        @par Example
+        @code
+        params_encoded_index qp( parse_query( "first=John&last=Doe" ).value() );
+
+        assert( qp.offset( 1 ) == 11 );
+        @endcode
+
+        @par Preconditions
+        @code
+        i < this->size()
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param i The zero-based index of
+        the param.
+    */
+    std::size_t
+    offset(std::size_t i) const noexcept;
+
+    /** Return the param containing a position
+
+        This function performs a binary search
+        for the param containing the offset
+        `pos` into @ref buffer. A position
+        holding a separating ampersand belongs
+        to the param which precedes it.
+
+        @par Example
+        @code
+        params_encoded_index qp( parse_query( "first=John&last=Doe" ).value() );
+
+        assert( qp.locate( 13 )->key == "last" );
+        @endcode
+
+        @par Complexity
+        Logarithmic in `this->size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return An iterator to the param, or
+        `end()` if the index is empty or `pos`
+        is not less than `this->buffer().size()`.
+
+        @param pos The offset into the buffer.
+    */
+    iterator
+    locate(std::size_t pos) const noexcept;
+
+private:
+    param_pct_view
+    get(std::size_t i) const noexcept;
+};
+
+} // urls
+} // boost
+
+#include <boost/url/impl/params_encoded_index.hpp>
+
+#endif
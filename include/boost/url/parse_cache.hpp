@@ -0,0 +1,269 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_PARSE_CACHE_HPP
+#define BOOST_URL_PARSE_CACHE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/system/result.hpp>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace boost {
+namespace urls {
+
+/** A cache of parsed request targets which may be shared between threads
+
+    This container remembers the offsets
+    computed when parsing strings, keyed by
+    the characters of the string. When a
+    string equal to one parsed recently is
+    parsed again, the view is built from the
+    stored offsets over the caller's
+    characters, after comparing them with
+    the stored copy, without parsing them
+    again. Strings which fail to parse are
+    not stored.
+
+    The cache holds a fixed number of
+    entries in sets of eight, each string
+    hashing to one set. When a set is full,
+    an entry not used since the last
+    eviction in that set is replaced, as by
+    the CLOCK algorithm, so that frequently
+    parsed strings remain in the cache.
+
+    The cache is divided into shards, each
+    protected by its own lock, so that
+    threads parsing different strings rarely
+    contend. The lock is held only to look up
+    or store an entry; strings are parsed
+    and hashed outside of it.
+
+    @par Example
+    @code
+    parse_cache cache;
+
+    auto rv = cache.parse_origin_form( "/index.htm?page=2" );
+    assert( rv && rv->encoded_path() == "/index.htm" );
+
+    rv = cache.parse_origin_form( "/index.htm?page=2" );
+    assert( rv && cache.hits() == 1 );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.
+    Shared objects: Safe.
+    When the library is built with
+    `BOOST_URL_DISABLE_THREADS`, shards
+    have no locks and shared objects
+    are unsafe.
+
+    @see
+        @ref parse_origin_form.
+*/
+class BOOST_URL_DECL parse_cache
+{
+public:
+    /** Options for constructing the cache
+    */
+    struct options
+    {
+        /** The number of entries
+
+            The value is rounded up, so that
+            each shard holds a power of two
+            sets of eight entries.
+        */
+        std::size_t capacity = 4096;
+
+        /** The number of shards
+
+            The value is rounded up to a power
+            of two. More shards reduce
+            contention between threads.
+        */
+        std::size_t shards = 16;
+
+        /** The size of the largest string stored
+
+            Longer strings are parsed each time.
+        */
+        std::size_t max_size = 2048;
+    };
+
+    /** Destructor
+    */
+    ~parse_cache();
+
+    /** Constructor
+
+        Default constructed caches hold 4096
+        entries, using 16 shards.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+    */
+    parse_cache();
+
+    /** Constructor
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `opt.capacity == 0` or `opt.shards == 0`.
+
+        @param opt The options to use.
+    */
+    explicit
+    parse_cache(
+        options const& opt);
+
+    parse_cache(
+        parse_cache const&) = delete;
+    parse_cache& operator=(
+        parse_cache const&) = delete;
+
+    /** Return the number of entries
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    /** Return the number of parses answered from the cache
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    hits() const noexcept
+    {
+        return hits_.load(
+            std::memory_order_relaxed);
+    }
+
+    /** Return the number of parses not answered from the cache
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    misses() const noexcept
+    {
+        return misses_.load(
+            std::memory_order_relaxed);
+    }
+
+    /** Parse an <em>origin-form</em>
+
+        The result is the same as that of
+        @ref urls::parse_origin_form. The
+        returned view references the
+        characters of `s`.
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @return A @ref result containing a
+        view to the url, or an error code if
+        the string is invalid.
+
+        @param s The string to parse.
+
+        @par Specification
+        @li <a href="https://datatracker.ietf.org/doc/html/rfc7230#section-5.3.1"
+            >5.3.1.  origin-form (rfc7230)</a>
+    */
+    system::result<url_view>
+    parse_origin_form(
+        core::string_view s);
+
+    /** Parse an <em>origin-form</em> and return its digest
+
+        This function behaves as the overload
+        without a digest, and sets `digest` to
+        the value of @ref url_hash for the
+        view upon success. The digest, which
+        requires normalization, is computed
+        once and stored in the cache.
+
+        @par Example
+        @code
+        parse_cache cache;
+        std::size_t h;
+
+        auto rv = cache.parse_origin_form( "/%7Euser/./a", h );
+        assert( rv && h == url_hash()( url_view( "/~user/a" ) ) );
+        @endcode
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @return A @ref result containing a
+        view to the url, or an error code if
+        the string is invalid.
+
+        @param s The string to parse.
+
+        @param digest The digest of the url,
+        set upon success.
+    */
+    system::result<url_view>
+    parse_origin_form(
+        core::string_view s,
+        std::size_t& digest);
+
+    /** Remove all entries
+
+        The counts of hits and misses are
+        also reset.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    void
+    clear() noexcept;
+
+private:
+    struct shard;
+
+    system::result<url_view>
+    parse_impl(
+        core::string_view s,
+        std::size_t* digest);
+
+    std::unique_ptr<shard[]> shards_;
+    std::size_t shard_mask_ = 0;
+    std::size_t set_mask_ = 0;
+    std::size_t capacity_ = 0;
+    std::size_t max_size_ = 0;
+    std::atomic<std::size_t> hits_{0};
+    std::atomic<std::size_t> misses_{0};
+};
+
+} // urls
+} // boost
+
+#endif
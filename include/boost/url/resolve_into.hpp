@@ -0,0 +1,147 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_RESOLVE_INTO_HPP
+#define BOOST_URL_RESOLVE_INTO_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/static_url.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/system/result.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** Resolve a URL reference against a base URL into a buffer
+
+    This function resolves the reference
+    `ref` against `base` as if by calling
+    @ref resolve, and writes the resulting
+    string to `dest`, which is not
+    null-terminated. The result is identical
+    to the string produced by @ref resolve.
+
+    Unlike @ref resolve, the size needed is
+    computed before anything is written, and
+    the merged path, including the removal of
+    dot segments, is written in one pass. No
+    memory is allocated.
+
+    @par Example
+    @code
+    char buf[ 64 ];
+    auto rv = resolve_into(
+        url_view( "http://a/b/c/d;p?q" ),
+        url_view( "../g#s" ), buf, sizeof( buf ) );
+
+    assert( rv && core::string_view( buf, *rv ) == "http://a/b/g#s" );
+    @endcode
+
+    @par Preconditions
+    `dest` does not overlap the characters
+    of `base` or `ref`.
+
+    @par Complexity
+    Linear in `base.size() + ref.size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return The number of characters written,
+    or an error if `! base.has_scheme()` or if
+    `size` is less than the size of the merged
+    string before normalization, which is at
+    most `base.size() + ref.size()`. Nothing
+    is written upon error.
+
+    @param base The base URL to resolve against.
+
+    @param ref The URL reference to resolve.
+
+    @param dest The buffer to write to.
+
+    @param size The size of the buffer.
+
+    @par Specification
+    <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-5"
+        >5. Reference Resolution (rfc3986)</a>
+
+    @see
+        @ref resolve.
+*/
+BOOST_URL_DECL
+system::result<std::size_t>
+resolve_into(
+    url_view_base const& base,
+    url_view_base const& ref,
+    char* dest,
+    std::size_t size) noexcept;
+
+/** Resolve a URL reference against a base URL into a static URL
+
+    This function resolves the reference
+    `ref` against `base` as if by calling
+    @ref resolve, writing the result directly
+    into the buffer of `dest` in one pass.
+    No memory is allocated, and no exception
+    is thrown when the result does not fit.
+
+    @par Example
+    @code
+    static_url< 64 > dest;
+    auto rv = resolve_into(
+        url_view( "http://a/b/c/d;p?q" ),
+        url_view( "g?y" ), dest );
+
+    assert( rv && dest.buffer() == "http://a/b/c/g?y" );
+    @endcode
+
+    @par Preconditions
+    `dest` is not `base` or `ref`.
+
+    @par Complexity
+    Linear in `base.size() + ref.size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return An empty @ref result upon success,
+    otherwise an error code if
+    `! base.has_scheme()` or if the capacity
+    of `dest` is less than the size of the
+    merged string before normalization, in
+    which case `dest` is unchanged.
+
+    @param base The base URL to resolve against.
+
+    @param ref The URL reference to resolve.
+
+    @param dest The container where the result
+    is written, upon success.
+
+    @par Specification
+    <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-5"
+        >5. Reference Resolution (rfc3986)</a>
+
+    @see
+        @ref resolve,
+        @ref static_url.
+*/
+BOOST_URL_DECL
+system::result<void>
+resolve_into(
+    url_view_base const& base,
+    url_view_base const& ref,
+    static_url_base& dest) noexcept;
+
+} // urls
+} // boost
+
+#endif
@@ -12,6 +12,7 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/error_types.hpp>
+#include <boost/url/grammar/alpha_chars.hpp>
 #include <boost/url/url_view.hpp>
 
 namespace boost {
@@ -29,6 +30,15 @@ struct absolute_uri_rule_t
         char const* end
             ) const noexcept ->
         system::result<value_type>;
+
+    // scheme begins with ALPHA
+    static
+    constexpr
+    bool
+    first_chars(char c) noexcept
+    {
+        return grammar::alpha_chars(c);
+    }
 };
 } // implementation_defined
 
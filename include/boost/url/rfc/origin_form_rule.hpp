@@ -28,6 +28,15 @@ struct origin_form_rule_t
         char const*& it,
         char const* end
             ) const noexcept;
+
+    // absolute-path begins with "/"
+    static
+    constexpr
+    bool
+    first_chars(char c) noexcept
+    {
+        return c == '/';
+    }
 };
 }
 
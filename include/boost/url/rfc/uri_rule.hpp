@@ -12,6 +12,7 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/error_types.hpp>
+#include <boost/url/grammar/alpha_chars.hpp>
 #include <boost/url/url_view.hpp>
 
 namespace boost {
@@ -59,6 +60,15 @@ struct uri_rule_t
         char const* const end
             ) const noexcept ->
         system::result<value_type>;
+
+    // scheme begins with ALPHA
+    static
+    constexpr
+    bool
+    first_chars(char c) noexcept
+    {
+        return grammar::alpha_chars(c);
+    }
 };
 } // implementation_defined
 
@@ -39,6 +39,7 @@ class segments_encoded_base
     detail::path_ref ref_;
 
     friend class url_view_base;
+    friend class segments_encoded_index;
     friend class segments_encoded_ref;
     friend class segments_encoded_view;
 
@@ -0,0 +1,350 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_SEGMENTS_ENCODED_INDEX_HPP
+#define BOOST_URL_SEGMENTS_ENCODED_INDEX_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/segments_encoded_view.hpp>
+#include <boost/url/detail/url_impl.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A random-access view of encoded path segments
+
+    Objects of this type store the position
+    of every segment in a path, so that
+    any segment can be accessed in constant
+    time. The positions are computed once,
+    upon construction, from a
+    @ref segments_encoded_view.
+
+    The index does not retain ownership of
+    the path and instead references the
+    original character buffer. The caller is
+    responsible for ensuring that the lifetime
+    of the buffer extends until it is no
+    longer referenced.
+
+    @par Example
+    @code
+    url_view u( "/path/to/file.txt" );
+    segments_encoded_index ps( u.encoded_segments() );
+
+    assert( ps[2] == "file.txt" );
+    assert( *(ps.begin() + 1) == "to" );
+    @endcode
+
+    @par Iterator Invalidation
+    Changes to the underlying character buffer
+    invalidate the index and all iterators
+    which reference it.
+
+    @see
+        @ref params_encoded_index,
+        @ref segments_encoded_view.
+*/
+class BOOST_URL_DECL segments_encoded_index
+{
+    detail::path_ref ref_;
+    std::vector<std::size_t> pos_;
+
+public:
+    /** A Random Access iterator to a path segment
+
+        Objects of this type allow random-access
+        iteration through the segments in the
+        path. Strings returned by iterators may
+        contain percent escapes.
+    */
+    class iterator;
+
+    /// @copydoc iterator
+    using const_iterator = iterator;
+
+    /** The value type
+
+        Values of this type represent a segment
+        where unique ownership is retained by
+        making a copy.
+    */
+    using value_type = std::string;
+
+    /** The reference type
+
+        This is the type of value returned when
+        iterators of the view are dereferenced.
+    */
+    using reference = pct_string_view;
+
+    /// @copydoc reference
+    using const_reference = pct_string_view;
+
+    /** An unsigned integer type used to represent size.
+    */
+    using size_type = std::size_t;
+
+    /** A signed integer type used to represent differences.
+    */
+    using difference_type = std::ptrdiff_t;
+
+    //--------------------------------------------
+    //
+    // Special Members
+    //
+    //--------------------------------------------
+
+    /** Constructor
+
+        Default-constructed indexes have
+        zero elements.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    segments_encoded_index() = default;
+
+    /** Constructor
+
+        This function computes the position of
+        every segment in `ps`. Upon construction,
+        the index references the same character
+        buffer as `ps`.
+
+        @par Example
+        @code
+        segments_encoded_index ps( parse_path( "/path/to/file.txt" ).value() );
+        @endcode
+
+        @par Postconditions
+        @code
+        this->buffer().data() == ps.buffer().data() && this->size() == ps.size()
+        @endcode
+
+        @par Complexity
+        Linear in `ps.buffer().size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param ps The segments to index.
+    */
+    explicit
+    segments_encoded_index(
+        segments_encoded_view const& ps);
+
+    //--------------------------------------------
+    //
+    // Observers
+    //
+    //--------------------------------------------
+
+    /** Return the referenced character buffer.
+
+        This function returns the character
+        buffer referenced by the index.
+        The returned string may contain
+        percent escapes.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    pct_string_view
+    buffer() const noexcept
+    {
+        return ref_.buffer();
+    }
+
+    /** Return true if there are no segments
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return pos_.empty();
+    }
+
+    /** Return the number of segments
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return pos_.size();
+    }
+
+    /** Return an iterator to the beginning
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    begin() const noexcept;
+
+    /** Return an iterator to the end
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    end() const noexcept;
+
+    /** Return a segment
+
+        @par Preconditions
+        @code
+        i < this->size()
+        @endcode
+
+        @par Complexity
+        Linear in the size of the segment.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param i The zero-based index of
+        the segment.
+    */
+    pct_string_view
+    operator[](std::size_t i) const noexcept;
+
+    /** Return the first segment
+
+        @par Preconditions
+        @code
+        this->empty() == false
+        @endcode
+
+        @par Complexity
+        Linear in the size of the segment.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    pct_string_view
+    front() const noexcept;
+
+    /** Return the last segment
+
+        @par Preconditions
+        @code
+        this->empty() == false
+        @endcode
+
+        @par Complexity
+        Linear in the size of the segment.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    pct_string_view
+    back() const noexcept;
+
+    /** Return the position of a segment
+
+        This function returns the offset
+        into @ref buffer of the first
+        character of the segment at index `i`.
+        The offsets are strictly increasing.
+
+        @par Example
+        @code
+        segments_encoded_index ps( parse_path( "/path/to/file.txt" ).value() );
+
+        assert( ps.offset( 1 ) == 6 );
+        @endcode
+
+        @par Preconditions
+        @code
+        i < this->size()
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param i The zero-based index of
+        the segment.
+    */
+    std::size_t
+    offset(std::size_t i) const noexcept;
+
+    /** Return the segment containing a position
+
+        This function performs a binary search
+        for the segment containing the offset
+        `pos` into @ref buffer. A position
+        holding a separating slash belongs
+        to the segment which precedes it.
+        If `pos` precedes the first segment,
+        the iterator to the first segment
+        is returned.
+
+        @par Example
+        @code
+        segments_encoded_index ps( parse_path( "/path/to/file.txt" ).value() );
+
+        assert( *ps.locate( 7 ) == "to" );
+        @endcode
+
+        @par Complexity
+        Logarithmic in `this->size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return An iterator to the segment, or
+        `end()` if the index is empty or `pos`
+        is not less than `this->buffer().size()`.
+
+        @param pos The offset into the buffer.
+    */
+    iterator
+    locate(std::size_t pos) const noexcept;
+
+private:
+    pct_string_view
+    get(std::size_t i) const noexcept;
+};
+
+} // urls
+} // boost
+
+#include <boost/url/impl/segments_encoded_index.hpp>
+
+#endif
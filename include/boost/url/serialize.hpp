@@ -0,0 +1,199 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_SERIALIZE_HPP
+#define BOOST_URL_SERIALIZE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/url_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** Return the size of the binary record for a url
+
+    This function returns the number of bytes
+    which @ref serialize_url writes for `u`.
+
+    @par Complexity
+    Constant.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @param u The url to measure.
+
+    @see
+        @ref deserialize_url,
+        @ref serialize_url.
+*/
+BOOST_URL_DECL
+std::size_t
+serialized_size(
+    url_view_base const& u) noexcept;
+
+/** Write the binary record for a url
+
+    This function stores `u` in a binary
+    record which holds the characters of the
+    url along with the precomputed results of
+    parsing: the offsets of each part, the
+    decoded sizes, the number of segments and
+    params, the host type, the address bytes,
+    the port number, and the scheme id.
+    A @ref url_view may later be obtained from
+    the record with @ref deserialize_url,
+    without parsing the url again.
+
+    The format is stable, and independent of
+    the byte order, the word size, and the
+    alignment of the machine. Records have no
+    alignment requirements, so they may be
+    stored back to back in a file.
+
+    @par Example
+    @code
+    url_view u( "https://www.example.com/path?id=42" );
+    std::string s( serialized_size( u ), '\0' );
+    serialize_url( &s[0], s.size(), u );
+
+    assert( deserialize_url( s ).value() == u );
+    @endcode
+
+    @par Complexity
+    Linear in `u.size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return The number of bytes written, or
+    zero if `size < serialized_size( u )` or
+    if `u.size()` is larger than the largest
+    value representable in 32 bits, in which
+    case nothing is written.
+
+    @param dest The destination buffer to
+    write to.
+
+    @param size The number of writable bytes
+    pointed to by `dest`.
+
+    @param u The url to serialize.
+
+    @see
+        @ref deserialize_url,
+        @ref serialized_size.
+*/
+BOOST_URL_DECL
+std::size_t
+serialize_url(
+    char* dest,
+    std::size_t size,
+    url_view_base const& u) noexcept;
+
+/** Return a url from its binary record
+
+    This function returns a view of the url
+    stored in the record beginning at `it`,
+    which must have been written by
+    @ref serialize_url. No parsing is
+    performed, and no memory is allocated:
+    the returned view references the
+    characters in the record. Upon success,
+    `it` is advanced past the record, so
+    records stored back to back in a
+    memory-mapped file may be visited
+    in sequence.
+
+    The record is checked only to the extent
+    required to ensure that the view does not
+    reference memory outside of the record.
+    The contents are otherwise trusted, so
+    records from untrusted sources should
+    instead be parsed.
+
+    @par Example
+    @code
+    char const* it = store.data();
+    char const* const end = it + store.size();
+    while( it != end )
+    {
+        url_view u = deserialize_url( it, end ).value();
+        // ...
+    }
+    @endcode
+
+    @par Complexity
+    Constant.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return A view of the url, or an error
+    if the record is truncated or invalid.
+    The error `grammar::error::need_more`
+    indicates that the record extends
+    past `end`.
+
+    @param it A reference to the beginning
+    of the record, which is advanced past the
+    record upon success.
+
+    @param end A pointer to one past the end
+    of the buffer containing the record.
+
+    @see
+        @ref serialize_url,
+        @ref serialized_size.
+*/
+BOOST_URL_DECL
+system::result<url_view>
+deserialize_url(
+    char const*& it,
+    char const* end) noexcept;
+
+/** Return a url from its binary record
+
+    This function returns a view of the url
+    stored in the record `s`, which must
+    have been written by @ref serialize_url.
+    The record must occupy the entire
+    string, or else an error is returned.
+
+    @par Example
+    @code
+    system::result< url_view > rv = deserialize_url( s );
+    @endcode
+
+    @par Complexity
+    Constant.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return A view of the url, or an error
+    if the record is truncated or invalid.
+
+    @param s The record.
+
+    @see
+        @ref serialize_url,
+        @ref serialized_size.
+*/
+BOOST_URL_DECL
+system::result<url_view>
+deserialize_url(
+    core::string_view s) noexcept;
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,391 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_SHARED_URL_HPP
+#define BOOST_URL_SHARED_URL_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <memory>
+
+namespace boost {
+namespace urls {
+
+/** An immutable URL with shared ownership
+
+    Objects of this type hold a read-only url
+    whose character buffer and offset table
+    are stored together in a single,
+    reference-counted allocation. Copies share
+    the allocation, so copying only increments
+    the reference count. The count is updated
+    atomically, and the url is never modified,
+    so copies may be passed between threads
+    freely.
+
+    The url is accessed through a @ref url_view
+    which refers to the shared allocation, and
+    which remains valid as long as any copy of
+    the shared url exists.
+    To modify the url, construct a @ref url
+    from it; the characters are copied and
+    the shared allocation is unaffected.
+
+    @par Example
+    @code
+    shared_url su( "https://www.example.com/path?id=42" );
+    shared_url su2 = su;                            // no allocation
+
+    assert( su2->data() == su->data() );            // same buffer
+
+    url u( *su );                                   // copy on write
+    u.set_host( "example.org" );
+
+    assert( su->host() == "www.example.com" );      // unchanged
+    @endcode
+
+    @see
+        @ref url,
+        @ref url_view,
+        @ref url_view_base::persist.
+*/
+class BOOST_URL_DECL shared_url
+{
+    std::shared_ptr<url_view const> sp_;
+
+public:
+    //--------------------------------------------
+    //
+    // Special Members
+    //
+    //--------------------------------------------
+
+    /** Destructor
+
+        The reference count is decremented,
+        and the shared allocation is released
+        if this was the last copy.
+    */
+    ~shared_url() = default;
+
+    /** Constructor
+
+        Default constructed shared urls contain
+        a zero-length string, and do not
+        perform a dynamic memory allocation.
+
+        @par Postconditions
+        @code
+        this->get().empty() == true
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    shared_url() noexcept = default;
+
+    /** Constructor
+
+        This function constructs a url from
+        the string `s`, which must contain a
+        valid <em>URI</em> or <em>relative-ref</em>
+        or else an exception is thrown.
+        The new object retains ownership by
+        allocating a copy of the passed string.
+
+        @par Example
+        @code
+        shared_url su( "https://www.example.com" );
+        @endcode
+
+        @par Effects
+        @code
+        return shared_url( parse_uri_reference( s ).value() );
+        @endcode
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        The input does not contain a valid url.
+
+        @param s The string to parse.
+
+        @par BNF
+        @code
+        URI           = scheme ":" hier-part [ "?" query ] [ "#" fragment ]
+
+        relative-ref  = relative-part [ "?" query ] [ "#" fragment ]
+        @endcode
+
+        @par Specification
+        @li <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-4.1"
+            >4.1. URI Reference</a>
+    */
+    explicit
+    shared_url(core::string_view s);
+
+    /** Constructor
+
+        The newly constructed object holds a
+        copy of `u` in a new shared allocation.
+
+        @par Postconditions
+        @code
+        this->get().buffer() == u.buffer() && this->get().data() != u.data()
+        @endcode
+
+        @par Complexity
+        Linear in `u.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param u The url to copy.
+    */
+    shared_url(url_view_base const& u);
+
+    /** Constructor
+
+        The newly constructed object shares
+        ownership of the url held by `other`.
+
+        @par Postconditions
+        @code
+        this->get().data() == other.get().data()
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    shared_url(shared_url const& other) noexcept = default;
+
+    /// @copydoc shared_url(shared_url const&)
+    shared_url(shared_url&& other) noexcept = default;
+
+    /** Assignment
+
+        After assignment, `this` shares
+        ownership of the url held by `other`.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    shared_url&
+    operator=(shared_url const& other) noexcept = default;
+
+    /// @copydoc operator=(shared_url const&)
+    shared_url&
+    operator=(shared_url&& other) noexcept = default;
+
+    //--------------------------------------------
+    //
+    // Observers
+    //
+    //--------------------------------------------
+
+    /** Return the url
+
+        The returned view references the
+        shared allocation, and remains valid
+        until the last copy of `this` is
+        destroyed or assigned.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_view const&
+    get() const noexcept;
+
+    /// @copydoc get
+    operator url_view const&() const noexcept
+    {
+        return get();
+    }
+
+    /// @copydoc get
+    url_view const&
+    operator*() const noexcept
+    {
+        return get();
+    }
+
+    /// @copydoc get
+    url_view const*
+    operator->() const noexcept
+    {
+        return &get();
+    }
+
+    /** Return the number of copies sharing the url
+
+        Zero is returned for a default
+        constructed object.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    long
+    use_count() const noexcept
+    {
+        return sp_.use_count();
+    }
+
+    /** Return a modifiable copy of the url
+
+        @par Example
+        @code
+        shared_url su( "https://www.example.com" );
+        url u = su.to_url().set_scheme( "wss" );
+        @endcode
+
+        @par Complexity
+        Linear in `this->get().size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+    */
+    url
+    to_url() const
+    {
+        return url(get());
+    }
+
+    //--------------------------------------------
+    //
+    // Comparison
+    //
+    //--------------------------------------------
+
+    /** Return the result of comparing two URLs
+
+        The URLs are compared component by
+        component as if they were first
+        normalized.
+
+        @par Complexity
+        Linear in `min( a.get().size(), b.get().size() )`
+
+        @par Exception Safety
+        Throws nothing
+    */
+    friend
+    bool
+    operator==(
+        shared_url const& a,
+        shared_url const& b) noexcept
+    {
+        return a.get() == b.get();
+    }
+
+    /// @copydoc operator==(shared_url const&, shared_url const&)
+    friend
+    bool
+    operator!=(
+        shared_url const& a,
+        shared_url const& b) noexcept
+    {
+        return a.get() != b.get();
+    }
+
+    /// @copydoc operator==(shared_url const&, shared_url const&)
+    friend
+    bool
+    operator<(
+        shared_url const& a,
+        shared_url const& b) noexcept
+    {
+        return a.get() < b.get();
+    }
+
+    /// @copydoc operator==(shared_url const&, shared_url const&)
+    friend
+    bool
+    operator<=(
+        shared_url const& a,
+        shared_url const& b) noexcept
+    {
+        return a.get() <= b.get();
+    }
+
+    /// @copydoc operator==(shared_url const&, shared_url const&)
+    friend
+    bool
+    operator>(
+        shared_url const& a,
+        shared_url const& b) noexcept
+    {
+        return a.get() > b.get();
+    }
+
+    /// @copydoc operator==(shared_url const&, shared_url const&)
+    friend
+    bool
+    operator>=(
+        shared_url const& a,
+        shared_url const& b) noexcept
+    {
+        return a.get() >= b.get();
+    }
+};
+
+} // urls
+} // boost
+
+//------------------------------------------------
+
+// std::hash specialization
+#ifndef BOOST_URL_DOCS
+namespace std {
+template<>
+struct hash< ::boost::urls::shared_url >
+{
+    hash() = default;
+    hash(hash const&) = default;
+    hash& operator=(hash const&) = default;
+
+    explicit
+    hash(std::size_t salt) noexcept
+        : h_(salt)
+    {
+    }
+
+    std::size_t
+    operator()(::boost::urls::shared_url const& u) const noexcept
+    {
+        return h_(u.get());
+    }
+
+private:
+    hash< ::boost::urls::url_view > h_;
+};
+} // std
+#endif
+
+#endif
@@ -22,6 +22,15 @@ namespace urls {
 #ifndef BOOST_URL_DOCS
 template<std::size_t Capacity>
 class static_url;
+
+class static_url_base;
+
+BOOST_URL_DECL
+system::result<void>
+resolve_into(
+    url_view_base const& base,
+    url_view_base const& ref,
+    static_url_base& dest) noexcept;
 #endif
 
 // VFALCO This class is for reducing
@@ -56,6 +65,13 @@ class BOOST_URL_DECL
     template<std::size_t>
     friend class static_url;
 
+    friend
+    system::result<void>
+    resolve_into(
+        url_view_base const&,
+        url_view_base const&,
+        static_url_base&) noexcept;
+
     ~static_url_base() = default;
     static_url_base(
         char* buf, std::size_t cap) noexcept;
@@ -71,6 +87,11 @@ class BOOST_URL_DECL
         this->url_base::copy(u);
     }
 
+    system::result<void>
+    resolve_into_impl(
+        url_view_base const& base,
+        url_view_base const& ref) noexcept;
+
 };
 
 //------------------------------------------------
@@ -12,6 +12,7 @@
 #define BOOST_URL_URL_BASE_HPP
 
 #include <boost/url/detail/config.hpp>
+#include <boost/url/alloc_stats.hpp>
 #include <boost/url/ipv4_address.hpp>
 #include <boost/url/ipv6_address.hpp>
 #include <boost/url/params_encoded_ref.hpp>
@@ -52,6 +53,7 @@ struct pattern;
         @li @ref url
         @li @ref url_view
         @li @ref static_url
+        @li @ref small_url
 
     @par Functions
         @li @ref parse_absolute_uri
@@ -66,9 +68,15 @@ class BOOST_URL_DECL
 {
     char* s_ = nullptr;
     std::size_t cap_ = 0;
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+    // changes the layout, so the build scripts
+    // pass the define to users of the library
+    alloc_stats stats_;
+#endif
 
     friend class url;
     friend class static_url_base;
+    friend class small_url_base;
     friend class params_ref;
     friend class segments_ref;
     friend class segments_encoded_ref;
@@ -150,6 +158,45 @@ public:
         return cap_;
     }
 
+    /** Return the memory counters of this url
+
+        This function returns the number of
+        buffers allocated for this url, and the
+        number of characters copied or moved by
+        its modifiers. The counters follow the
+        buffer when a url is moved or swapped.
+        Unless the library and the program are
+        compiled with the macro
+        `BOOST_URL_ENABLE_TELEMETRY` defined,
+        every counter is zero.
+
+        @par Example
+        @code
+        url u( "https://www.example.com" );
+        u.set_path( "/path/to/file.txt" );
+        std::cout << u.stats().reallocations << " reallocations\n";
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @see
+            @ref alloc_stats,
+            @ref alloc_stats_snapshot.
+    */
+    alloc_stats
+    stats() const noexcept
+    {
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+        return stats_;
+#else
+        return {};
+#endif
+    }
+
     /** Clear the contents while preserving the capacity
 
         @par Postconditions
@@ -2603,7 +2650,9 @@ public:
         Percent-encoding triplets are normalized
         to uppercase letters. Percent-encoded
         octets that correspond to unreserved
-        characters are decoded.
+        characters are decoded. An IPv6 address
+        without a zone id is written in its
+        canonical form.
 
         @par Exception Safety
         Strong guarantee.
@@ -2612,6 +2661,8 @@ public:
         @par Specification
         @li <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-6.2.2"
             >6.2.2 Syntax-Based Normalization (rfc3986)</a>
+        @li <a href="https://datatracker.ietf.org/doc/html/rfc5952#section-4"
+            >4. A Recommendation for IPv6 Text Representation (rfc5952)</a>
 
     */
     url_base&
@@ -0,0 +1,301 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_BLOCKLIST_HPP
+#define BOOST_URL_URL_BLOCKLIST_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/segments_encoded_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/optional.hpp>
+#include <boost/system/result.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A set of rules blocking URLs by host suffix and path prefix
+
+    Each rule holds a host suffix and a path
+    prefix, either of which may be empty. A
+    url is blocked by a rule when its host
+    ends with the suffix, comparing whole
+    labels, and its path begins with the
+    prefix, comparing whole segments. An
+    empty suffix matches every host, and an
+    empty prefix matches every path.
+
+    The suffixes are stored in a trie whose
+    edges are the labels of the hosts, from
+    right to left, and each host in the trie
+    may hold a trie whose edges are path
+    segments. The children of all the nodes
+    are found in one hash table, so that a
+    url is checked in time proportional to
+    its size, regardless of the number of
+    rules.
+
+    Labels are compared after decoding
+    percent-escapes and converting letters
+    to lower case, and segments are compared
+    after decoding percent-escapes. Labels
+    are separated by dots, which may be
+    percent-encoded, and dot segments in the
+    path of a checked url are removed as in
+    @ref url_base::normalize_path, so that
+    escapes cannot be used to bypass a rule.
+    A leading or trailing dot in a host, and
+    a trailing slash in a path prefix, are
+    ignored.
+
+    The rules may be saved with
+    @ref serialize and restored with
+    @ref deserialize, which copies the
+    tables without building them again.
+
+    @par Example
+    @code
+    url_blocklist bl;
+    auto id0 = bl.add_host( "ads.example.com" );
+    auto id1 = bl.add( "example.org", "/tracking" );
+
+    assert( bl.find( url_view( "https://x.ADS.example.com/" ) ) == id0 );
+    assert( bl.find( url_view( "https://www.example.org/tracking/1" ) ) == id1 );
+    assert( ! bl.blocked( url_view( "https://www.example.org/tracker" ) ) );
+    assert( ! bl.blocked( url_view( "https://badexample.org/tracking" ) ) );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.
+    Shared objects: Unsafe.
+    Calls to const member functions on a
+    shared object are safe.
+*/
+class BOOST_URL_DECL url_blocklist
+{
+    struct node
+    {
+        std::uint32_t parent;
+        std::uint32_t label;
+        std::uint32_t size;
+        std::uint32_t hash;
+        std::uint32_t rule;
+        std::uint32_t sub;
+    };
+
+    std::vector<node> nodes_;
+    std::vector<std::uint32_t> slots_;
+    std::string labels_;
+    std::size_t rules_ = 0;
+
+    std::uint32_t new_node(
+        std::uint32_t parent,
+        core::string_view label,
+        bool icase);
+    std::uint32_t find_child(
+        std::uint32_t parent,
+        core::string_view label,
+        bool icase) const noexcept;
+    template<class Segments>
+    std::uint32_t find_rule(
+        std::uint32_t p,
+        Segments const& segs) const noexcept;
+    void grow();
+
+public:
+    /** Constructor
+
+        Default constructed blocklists
+        have no rules.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+    */
+    url_blocklist();
+
+    /** Return the number of rules
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return rules_;
+    }
+
+    /** Add a rule
+
+        If a rule with the same host suffix
+        and path prefix exists, its id is
+        returned and no rule is added.
+
+        @par Complexity
+        Linear in `host.size() + path.size()`,
+        amortized.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `host` contains an invalid
+        percent-encoding, `path` is not a valid
+        path, or the tables are full.
+
+        @return The id of the rule.
+
+        @param host The encoded host suffix.
+
+        @param path The encoded path prefix.
+    */
+    std::size_t
+    add(
+        core::string_view host,
+        core::string_view path);
+
+    /** Add a rule blocking a host suffix
+
+        This is equivalent to
+        `add( host, "" )`.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `host` contains an invalid
+        percent-encoding, or the tables are
+        full.
+
+        @return The id of the rule.
+
+        @param host The encoded host suffix.
+    */
+    std::size_t
+    add_host(core::string_view host)
+    {
+        return add(host, {});
+    }
+
+    /** Add a rule blocking a path prefix
+
+        This is equivalent to
+        `add( "", path )`.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `path` is not a valid path, or the
+        tables are full.
+
+        @return The id of the rule.
+
+        @param path The encoded path prefix.
+    */
+    std::size_t
+    add_path(core::string_view path)
+    {
+        return add({}, path);
+    }
+
+    /** Return the id of a rule blocking the url
+
+        When several rules block the url,
+        shorter host suffixes are checked
+        first, and for each, shorter path
+        prefixes.
+
+        @par Complexity
+        Linear in the size of the host, plus
+        the size of the path for each host
+        suffix which has rules with a path.
+
+        @par Exception Safety
+        Calls to allocate may throw, only
+        when the path holds dot segments.
+
+        @return The id of the rule, or an
+        empty optional if the url is not
+        blocked.
+
+        @param u The url to check.
+    */
+    boost::optional<std::size_t>
+    find(url_view_base const& u) const;
+
+    /** Return true if a rule blocks the url
+
+        @par Exception Safety
+        Calls to allocate may throw, only
+        when the path holds dot segments.
+
+        @param u The url to check.
+    */
+    bool
+    blocked(url_view_base const& u) const
+    {
+        return find(u).has_value();
+    }
+
+    /** Return the number of bytes of memory used
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    memory_usage() const noexcept;
+
+    /** Return the rules in serialized form
+
+        The returned string holds the tables
+        in a portable binary format, which is
+        restored by @ref deserialize.
+
+        @par Complexity
+        Linear in the size of the tables.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+    */
+    std::string
+    serialize() const;
+
+    /** Return rules from their serialized form
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @return The rules, or an error if
+        `s` was not returned by
+        @ref serialize.
+
+        @param s The serialized rules.
+    */
+    static
+    system::result<url_blocklist>
+    deserialize(core::string_view s);
+};
+
+} // urls
+} // boost
+
+#endif
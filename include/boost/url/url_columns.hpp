@@ -0,0 +1,522 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_COLUMNS_HPP
+#define BOOST_URL_URL_COLUMNS_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/host_type.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/scheme.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/optional.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A batch of URLs decomposed into columns
+
+    This container stores a sequence of urls
+    as a structure of arrays rather than as
+    an array of @ref url objects, so that a
+    query over one part of every url, such as
+    counting urls by host or selecting those
+    whose scheme is https, reads only the
+    column for that part.
+
+    Each row holds one url, and has
+    <ul>
+    <li>the scheme id, in @ref schemes,
+    <li>the host type, in @ref host_types,
+    <li>the id of the host in a dictionary
+        of distinct hosts, in @ref hosts.
+        Hosts which compare equal as in
+        @ref url_view_base::compare, such as
+        "EXAMPLE.com" and "example.com", have
+        the same id,
+    <li>the port number, in @ref port_numbers,
+    <li>and the path, query, and fragment,
+        stored in one character heap per part.
+    </ul>
+
+    Urls appended as strings are parsed in
+    place and decomposed directly from the
+    results of parsing, without constructing
+    any @ref url. The scheme characters,
+    userinfo, and port string are not stored.
+
+    The functions which select or count rows
+    by the value of a column compare many rows
+    at a time where SSE2 is available.
+
+    @par Example
+    @code
+    url_columns uc;
+    uc.append( "https://www.example.com/a" ).value();
+    uc.append( "http://www.boost.org/" ).value();
+    uc.append( "https://www.example.com/b?c" ).value();
+
+    assert( uc.count( scheme::https ) == 2 );
+
+    std::vector< std::size_t > rows;
+    uc.select_host( "www.example.com", rows );
+    assert( rows.size() == 2 && uc.encoded_path( rows[1] ) == "/b" );
+    @endcode
+
+    @see
+        @ref parse_uri_reference.
+*/
+class BOOST_URL_DECL url_columns
+{
+    // the characters of one part for each row
+    struct heap
+    {
+        std::string s;
+        std::vector<std::size_t> off{ 0 };
+        std::vector<std::size_t> dn;
+    };
+
+    std::vector<scheme> scheme_;
+    std::vector<host_type> host_type_;
+    std::vector<std::uint32_t> host_;
+    std::vector<std::uint16_t> port_;
+    std::vector<unsigned char> flags_;
+    heap path_;
+    heap query_;
+    heap frag_;
+
+    // dictionary of hosts
+    std::string dict_;
+    std::vector<std::size_t> dict_off_{ 0 };
+    std::vector<std::uint32_t> dict_slots_;
+
+    std::uint32_t intern(core::string_view);
+    void grow_dict();
+
+    static
+    pct_string_view
+    get(heap const&, std::size_t) noexcept;
+
+public:
+    /** Constructor
+
+        Default constructed batches are empty.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+    */
+    url_columns();
+
+    /** Append a url, parsing it first
+
+        The string is parsed as a
+        <em>URI-reference</em>. If parsing
+        fails, no row is appended.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @return The row index, or an error.
+
+        @param s The string to parse.
+    */
+    system::result<std::size_t>
+    append(core::string_view s);
+
+    /** Append a url
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @return The row index.
+
+        @param u The url to append.
+    */
+    std::size_t
+    append(url_view_base const& u);
+
+    /** Reserve space for rows
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param n The number of rows.
+    */
+    void
+    reserve(std::size_t n);
+
+    /** Remove all rows
+
+        The dictionary of hosts is also cleared.
+        Capacity is retained.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    void
+    clear() noexcept;
+
+    /** Return the number of rows
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return scheme_.size();
+    }
+
+    /** Return true if there are no rows
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return scheme_.empty();
+    }
+
+    //--------------------------------------------
+    //
+    // Columns
+    //
+    //--------------------------------------------
+
+    /** Return the column of scheme ids
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::vector<scheme> const&
+    schemes() const noexcept
+    {
+        return scheme_;
+    }
+
+    /** Return the column of host types
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::vector<host_type> const&
+    host_types() const noexcept
+    {
+        return host_type_;
+    }
+
+    /** Return the column of host ids
+
+        Each value is the id of the normalized
+        host in the dictionary of hosts, which
+        may be converted back to the host with
+        @ref host. A url without a host has
+        the id of the empty string, zero.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::vector<std::uint32_t> const&
+    hosts() const noexcept
+    {
+        return host_;
+    }
+
+    /** Return the column of port numbers
+
+        The value is zero for a url without
+        a port number.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::vector<std::uint16_t> const&
+    port_numbers() const noexcept
+    {
+        return port_;
+    }
+
+    /** Return the path of a row
+
+        @par Preconditions
+        @code
+        row < this->size()
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param row The row index.
+    */
+    pct_string_view
+    encoded_path(std::size_t row) const noexcept
+    {
+        return get(path_, row);
+    }
+
+    /** Return true if a row has a query
+
+        @par Preconditions
+        @code
+        row < this->size()
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param row The row index.
+    */
+    bool
+    has_query(std::size_t row) const noexcept
+    {
+        return (flags_[row] & 1) != 0;
+    }
+
+    /** Return the query of a row
+
+        @par Preconditions
+        @code
+        row < this->size()
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param row The row index.
+    */
+    pct_string_view
+    encoded_query(std::size_t row) const noexcept
+    {
+        return get(query_, row);
+    }
+
+    /** Return true if a row has a fragment
+
+        @par Preconditions
+        @code
+        row < this->size()
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param row The row index.
+    */
+    bool
+    has_fragment(std::size_t row) const noexcept
+    {
+        return (flags_[row] & 2) != 0;
+    }
+
+    /** Return the fragment of a row
+
+        @par Preconditions
+        @code
+        row < this->size()
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param row The row index.
+    */
+    pct_string_view
+    encoded_fragment(std::size_t row) const noexcept
+    {
+        return get(frag_, row);
+    }
+
+    //--------------------------------------------
+    //
+    // Dictionary
+    //
+    //--------------------------------------------
+
+    /** Return the number of distinct hosts
+
+        This includes the empty host.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    host_count() const noexcept
+    {
+        return dict_off_.size() - 1;
+    }
+
+    /** Return the host with the given id
+
+        The host is returned in its normalized
+        form: IPv6 addresses in canonical form,
+        and other hosts in lower case, with
+        escapes only where required.
+
+        @par Preconditions
+        @code
+        id < this->host_count()
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param id The host id.
+    */
+    core::string_view
+    host(std::uint32_t id) const noexcept
+    {
+        return core::string_view(
+            dict_.data() + dict_off_[id],
+            dict_off_[id + 1] - dict_off_[id]);
+    }
+
+    /** Return the id of an encoded host
+
+        The host is normalized first, so that
+        any host which compares equal to one
+        in the dictionary is found.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The id, or an empty optional
+        if no row has the host.
+
+        @param s The encoded host.
+    */
+    boost::optional<std::uint32_t>
+    find_host(core::string_view s) const noexcept;
+
+    //--------------------------------------------
+    //
+    // Queries
+    //
+    //--------------------------------------------
+
+    /** Return the number of rows with a scheme
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param id The scheme id.
+    */
+    std::size_t
+    count(scheme id) const noexcept;
+
+    /** Append the indexes of the rows with a scheme
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param id The scheme id.
+
+        @param rows The container to append
+        the row indexes to.
+    */
+    void
+    select(
+        scheme id,
+        std::vector<std::size_t>& rows) const;
+
+    /** Append the indexes of the rows with an encoded host
+
+        Rows whose host compares equal to `s`
+        after normalization are selected.
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param s The encoded host.
+
+        @param rows The container to append
+        the row indexes to.
+    */
+    void
+    select_host(
+        core::string_view s,
+        std::vector<std::size_t>& rows) const;
+
+    /** Append the indexes of the rows with a port number
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param port The port number.
+
+        @param rows The container to append
+        the row indexes to.
+    */
+    void
+    select_port(
+        std::uint16_t port,
+        std::vector<std::size_t>& rows) const;
+
+    /** Return the number of rows for each scheme
+
+        Element `i` of the result is the number
+        of rows whose scheme id has the value
+        `i`, for each value of @ref scheme.
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+    */
+    std::vector<std::size_t>
+    count_by_scheme() const;
+
+    /** Return the number of rows for each host
+
+        Element `i` of the result is the number
+        of rows whose host has the id `i`.
+
+        @par Example
+        @code
+        auto counts = uc.count_by_host();
+        for( std::uint32_t id = 0; id < counts.size(); ++id )
+            std::cout << uc.host( id ) << ": " << counts[id] << "\n";
+        @endcode
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+    */
+    std::vector<std::size_t>
+    count_by_host() const;
+};
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,245 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_CORPUS_HPP
+#define BOOST_URL_URL_CORPUS_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A parsed collection of newline-delimited URLs
+
+    This container parses text holding one
+    <em>URI-reference</em> per line, such as
+    a crawl frontier or a log of requests,
+    and stores a @ref url_view for each line
+    which parses successfully. The views
+    reference the original text; the
+    characters of the urls are never copied.
+    The text is commonly the contents of a
+    memory-mapped file, in which case only the
+    pages holding the urls are ever read.
+
+    The text is split into chunks of
+    approximately @ref options::chunk_size
+    bytes, each ending just after a newline.
+    The chunks are parsed concurrently by a
+    pool of threads, and the results of each
+    chunk are kept separate, in the order in
+    which the chunks appear in the text.
+
+    Lines are delimited by LF or CRLF.
+    Empty lines are skipped, and lines which
+    fail to parse are counted as errors.
+
+    @par Example
+    @code
+    url_corpus uc( "https://www.example.com\n/index.htm\nhttp://[\n" );
+
+    assert( uc.size() == 2 );
+    assert( uc.errors() == 1 );
+    assert( uc.chunks()[0].urls[1].encoded_path() == "/index.htm" );
+    @endcode
+
+    @par Thread Safety
+    When the library is built with
+    `BOOST_URL_DISABLE_THREADS`, chunks are
+    parsed sequentially by the calling thread.
+
+    @see
+        @ref parse_uri_reference.
+*/
+class BOOST_URL_DECL url_corpus
+{
+public:
+    /** Options for parsing the corpus
+    */
+    struct options
+    {
+        /** The number of threads used to parse
+
+            If this is zero, the number of
+            hardware threads is used.
+        */
+        std::size_t threads = 0;
+
+        /** The approximate size of each chunk, in bytes
+
+            This must not be zero.
+        */
+        std::size_t chunk_size = 1024 * 1024;
+    };
+
+    /** The results of parsing one chunk
+    */
+    struct chunk
+    {
+        /** The characters of the chunk
+        */
+        core::string_view text;
+
+        /** The line number of the first line in the chunk
+
+            Lines are numbered from zero.
+        */
+        std::size_t first_line = 0;
+
+        /** The number of lines in the chunk
+
+            This includes empty lines and
+            lines which failed to parse.
+        */
+        std::size_t lines = 0;
+
+        /** The urls which parsed successfully
+        */
+        std::vector<url_view> urls;
+
+        /** The number of lines which failed to parse
+        */
+        std::size_t errors = 0;
+
+        /** The error for the first line which failed to parse
+
+            This is empty if `errors == 0`.
+        */
+        system::error_code first_error;
+
+        /** The line number of the first line which failed to parse
+
+            This is only meaningful if
+            `errors != 0`.
+        */
+        std::size_t first_error_line = 0;
+    };
+
+    /** Constructor
+
+        Default constructed corpuses are empty.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_corpus() noexcept = default;
+
+    /** Constructor
+
+        The text is parsed with the default
+        options, and the results stored in the
+        container. The caller is responsible
+        for ensuring that the lifetime of the
+        text extends until it is no longer
+        referenced by the container or by any
+        of its urls.
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param s The text to parse.
+    */
+    explicit
+    url_corpus(
+        core::string_view s);
+
+    /** Constructor
+
+        The text is parsed, and the results
+        stored in the container. The caller is
+        responsible for ensuring that the
+        lifetime of the text extends until it
+        is no longer referenced by the
+        container or by any of its urls.
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `opt.chunk_size == 0`.
+
+        @param s The text to parse.
+
+        @param opt The options to use.
+    */
+    explicit
+    url_corpus(
+        core::string_view s,
+        options const& opt);
+
+    /** Return the results for each chunk
+
+        The chunks appear in the same order
+        as in the text.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::vector<chunk> const&
+    chunks() const noexcept
+    {
+        return v_;
+    }
+
+    /** Return the number of lines
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    lines() const noexcept
+    {
+        return lines_;
+    }
+
+    /** Return the number of urls which parsed successfully
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    /** Return the number of lines which failed to parse
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    errors() const noexcept
+    {
+        return errors_;
+    }
+
+private:
+    std::vector<chunk> v_;
+    std::size_t lines_ = 0;
+    std::size_t size_ = 0;
+    std::size_t errors_ = 0;
+};
+
+} // urls
+} // boost
+
+#endif
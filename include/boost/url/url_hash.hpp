@@ -0,0 +1,186 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_HASH_HPP
+#define BOOST_URL_URL_HASH_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** A transparent hash function for URLs
+
+    This function object returns the digest of
+    any url derived from @ref url_view_base, or
+    of a string which is first parsed as a
+    <em>URI-reference</em>. Equivalent urls have
+    the same digest, which is the same as the
+    one computed by the `std::hash`
+    specializations for urls.
+    Strings which are not valid urls are hashed
+    as-is; they are only equal to themselves.
+
+    The member `is_transparent` allows a
+    container whose elements are @ref url to be
+    searched with a @ref url_view, or with a
+    string when the container supports
+    heterogeneous lookup of any key type,
+    without constructing a @ref url.
+
+    @par Example
+    @code
+    boost::unordered_set< url, url_hash, url_equal > s;
+    s.emplace( "https://www.example.com/index.htm" );
+
+    assert( s.find( url_view( "HTTPS://www.EXAMPLE.com/./index.htm" ) ) != s.end() );
+    @endcode
+
+    @see
+        @ref url_equal.
+*/
+struct url_hash
+{
+    /** Enables heterogeneous lookup
+    */
+    using is_transparent = void;
+
+    /** Constructor
+    */
+    url_hash() = default;
+
+    /** Constructor
+
+        @param salt The value added to the
+        initial state of the hash function.
+    */
+    explicit
+    url_hash(std::size_t salt) noexcept
+        : salt_(salt)
+    {
+    }
+
+    /** Return the digest of a url
+
+        @par Complexity
+        Linear in `u.size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param u The url to hash.
+    */
+    std::size_t
+    operator()(
+        url_view_base const& u) const noexcept
+    {
+        return std::hash<url_view>(
+            salt_)(u);
+    }
+
+    /** Return the digest of a string
+
+        The string is parsed as a
+        <em>URI-reference</em>. No memory
+        is allocated.
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param s The string to hash.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    operator()(
+        core::string_view s) const noexcept;
+
+private:
+    std::size_t salt_ = 0;
+};
+
+//------------------------------------------------
+
+/** A transparent equality function for URLs
+
+    This function object returns `true` if two
+    urls are equivalent, using the same rules
+    as `operator==` for @ref url_view_base.
+    Either argument may instead be a string,
+    which is first parsed as a
+    <em>URI-reference</em>. A string which is
+    not a valid url is only equal to an
+    identical string.
+
+    @par Example
+    @code
+    url_equal eq;
+
+    assert( eq( url_view( "http://example.com" ), "HTTP://EXAMPLE.COM" ) );
+    @endcode
+
+    @see
+        @ref url_hash,
+        @ref url_view_base::compare.
+*/
+struct url_equal
+{
+    /** Enables heterogeneous lookup
+    */
+    using is_transparent = void;
+
+    /** Return true if two urls are equivalent
+
+        @par Complexity
+        Linear in `min( u0.size(), u1.size() )`.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    operator()(
+        url_view_base const& u0,
+        url_view_base const& u1) const noexcept
+    {
+        return u0 == u1;
+    }
+
+    /// @copydoc operator()(url_view_base const&, url_view_base const&) const
+    BOOST_URL_DECL
+    bool
+    operator()(
+        url_view_base const& u0,
+        core::string_view s1) const noexcept;
+
+    /// @copydoc operator()(url_view_base const&, url_view_base const&) const
+    bool
+    operator()(
+        core::string_view s0,
+        url_view_base const& u1) const noexcept
+    {
+        return (*this)(u1, s0);
+    }
+
+    /// @copydoc operator()(url_view_base const&, url_view_base const&) const
+    BOOST_URL_DECL
+    bool
+    operator()(
+        core::string_view s0,
+        core::string_view s1) const noexcept;
+};
+
+} // urls
+} // boost
+
+#endif
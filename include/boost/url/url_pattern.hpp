@@ -0,0 +1,298 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_PATTERN_HPP
+#define BOOST_URL_URL_PATTERN_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/glob_nfa.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+#ifndef BOOST_URL_DOCS
+class url_pattern_set;
+#endif
+
+/** A pattern matching the components of a URL
+
+    This object holds a glob pattern for each
+    of the protocol, hostname, pathname,
+    search, and hash of a url, in the manner
+    of the URLPattern of the WHATWG. A url
+    matches when every component matches
+    its pattern. Each pattern is compiled
+    into an automaton when it is set, so that
+    matching is linear in the size of the
+    url and does not allocate for short
+    patterns.
+
+    The components are compared with the
+    values returned by `scheme()`,
+    `encoded_host()`, `encoded_path()`,
+    `encoded_query()`, and
+    `encoded_fragment()`. A url with no query
+    or fragment has an empty search or hash.
+    The protocol and hostname are matched
+    without regard to case.
+
+    In a pattern, `*` matches any sequence
+    of characters other than '/', `**`
+    matches any sequence of characters, and
+    a backslash makes the character after it
+    match literally. All other characters
+    match themselves. The pattern of a
+    component which is not set is `**`.
+
+    @par Example
+    @code
+    url_pattern p;
+    p.set_protocol( "http*" ).set_hostname( "**.example.com" ).set_pathname( "**.html" );
+
+    assert( p.match( url_view( "https://www.example.com/docs/a/b.html" ) ) );
+    assert( ! p.match( url_view( "https://example.org/docs/a/b.html" ) ) );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.
+    Shared objects: Unsafe.
+    Calls to `match` on a shared object are
+    safe.
+
+    @see
+        @ref url_pattern_set.
+*/
+class BOOST_URL_DECL url_pattern
+{
+    friend class url_pattern_set;
+
+    enum
+    {
+        id_protocol,
+        id_hostname,
+        id_pathname,
+        id_search,
+        id_hash,
+        id_end
+    };
+
+    std::string s_[id_end];
+    detail::glob_nfa nfa_[id_end];
+
+    static
+    core::string_view
+    part(
+        url_view_base const& u,
+        int id) noexcept;
+
+    static
+    bool
+    is_any(core::string_view s) noexcept
+    {
+        return s == "**";
+    }
+
+    void set(int id, core::string_view s);
+
+public:
+    /** Constructor
+
+        Default constructed patterns match
+        every url.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+    */
+    url_pattern();
+
+    /** Return the pattern for the protocol
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    protocol() const noexcept
+    {
+        return s_[id_protocol];
+    }
+
+    /** Return the pattern for the hostname
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    hostname() const noexcept
+    {
+        return s_[id_hostname];
+    }
+
+    /** Return the pattern for the pathname
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    pathname() const noexcept
+    {
+        return s_[id_pathname];
+    }
+
+    /** Return the pattern for the search
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    search() const noexcept
+    {
+        return s_[id_search];
+    }
+
+    /** Return the pattern for the hash
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    hash() const noexcept
+    {
+        return s_[id_hash];
+    }
+
+    /** Set the pattern for the protocol
+
+        The pattern is matched with the
+        scheme, without the trailing colon.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` ends in an unescaped backslash.
+
+        @param s The pattern.
+    */
+    url_pattern&
+    set_protocol(core::string_view s)
+    {
+        set(id_protocol, s);
+        return *this;
+    }
+
+    /** Set the pattern for the hostname
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` ends in an unescaped backslash.
+
+        @param s The pattern.
+    */
+    url_pattern&
+    set_hostname(core::string_view s)
+    {
+        set(id_hostname, s);
+        return *this;
+    }
+
+    /** Set the pattern for the pathname
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` ends in an unescaped backslash.
+
+        @param s The pattern.
+    */
+    url_pattern&
+    set_pathname(core::string_view s)
+    {
+        set(id_pathname, s);
+        return *this;
+    }
+
+    /** Set the pattern for the search
+
+        The pattern is matched with the
+        query, without the leading question
+        mark.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` ends in an unescaped backslash.
+
+        @param s The pattern.
+    */
+    url_pattern&
+    set_search(core::string_view s)
+    {
+        set(id_search, s);
+        return *this;
+    }
+
+    /** Set the pattern for the hash
+
+        The pattern is matched with the
+        fragment, without the leading
+        number sign.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` ends in an unescaped backslash.
+
+        @param s The pattern.
+    */
+    url_pattern&
+    set_hash(core::string_view s)
+    {
+        set(id_hash, s);
+        return *this;
+    }
+
+    /** Return true if the url matches the pattern
+
+        @par Complexity
+        Linear in `u.size()` times the size
+        of the longest component pattern,
+        divided by 64.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param u The url to match.
+    */
+    bool
+    match(url_view_base const& u) const;
+};
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,272 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_PATTERN_SET_HPP
+#define BOOST_URL_URL_PATTERN_SET_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/glob_nfa.hpp>
+#include <boost/url/url_pattern.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A set of URL patterns matched together
+
+    This container holds a sequence of
+    @ref url_pattern, called rules, each
+    identified by its index in the sequence.
+    The patterns of all the rules for one
+    component are compiled into a single
+    automaton, so that a url is matched
+    against every rule in one pass over each
+    of its components, rather than one pass
+    for each rule. Components whose pattern
+    is `**` are not part of the automaton.
+
+    @par Example
+    @code
+    url_pattern_set rules = {
+        url_pattern().set_hostname( "**.example.com" ),
+        url_pattern().set_pathname( "**.html" ),
+        url_pattern().set_protocol( "ftp" ) };
+
+    std::vector< std::size_t > ids;
+    rules.match( url_view( "https://www.example.com/docs/index.html" ), ids );
+
+    assert( ids.size() == 2 && ids[0] == 0 && ids[1] == 1 );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.
+    Shared objects: Unsafe.
+    Calls to `match` on a shared object are
+    safe.
+
+    @see
+        @ref url_pattern.
+*/
+class BOOST_URL_DECL url_pattern_set
+{
+    std::vector<url_pattern> v_;
+    detail::glob_nfa nfa_[url_pattern::id_end];
+
+    // the rule of each pattern
+    // in the automaton
+    std::vector<std::size_t> ids_[url_pattern::id_end];
+
+    void build();
+
+public:
+    /** Constructor
+
+        Default constructed sets are empty.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_pattern_set() noexcept = default;
+
+    /** Constructor
+
+        The rules are the patterns in the
+        range, in order.
+
+        @par Constraints
+        @code
+        std::is_convertible<
+            std::iterator_traits< FwdIt >::reference,
+            url_pattern const& >::value == true
+        @endcode
+
+        @par Complexity
+        Linear in the total size of the patterns.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param first The first pattern in the range.
+
+        @param last One past the last pattern in the range.
+    */
+    template<class FwdIt>
+    url_pattern_set(
+        FwdIt first,
+        FwdIt last)
+        : v_(first, last)
+    {
+        build();
+    }
+
+    /** Constructor
+
+        The rules are the patterns in the
+        list, in order.
+
+        @par Complexity
+        Linear in the total size of the patterns.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param init The patterns.
+    */
+    url_pattern_set(
+        std::initializer_list<url_pattern> init)
+        : url_pattern_set(init.begin(), init.end())
+    {
+    }
+
+    /** Return the number of rules
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return v_.size();
+    }
+
+    /** Return true if there are no rules
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return v_.empty();
+    }
+
+    /** Return the rule with the given id
+
+        @par Preconditions
+        `id < size()`
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param id The id of the rule.
+    */
+    url_pattern const&
+    operator[](std::size_t id) const noexcept
+    {
+        return v_[id];
+    }
+
+    /** Add a rule
+
+        The automata are compiled again for
+        the new set of rules. To add many
+        rules, add them all at once with
+        the overload taking a range, or
+        construct the set from the range,
+        which compile the automata once
+        instead of once per rule.
+
+        @par Complexity
+        Linear in the total size of the patterns.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @return The id of the new rule,
+        which is equal to the previous
+        value of @ref size.
+
+        @param p The pattern to add.
+    */
+    std::size_t
+    add(url_pattern const& p);
+
+    /** Add rules
+
+        The patterns in the range are added
+        as rules, in order, and the automata
+        are compiled once for the new set of
+        rules.
+
+        @par Constraints
+        @code
+        std::is_convertible<
+            std::iterator_traits< FwdIt >::reference,
+            url_pattern const& >::value == true
+        @endcode
+
+        @par Complexity
+        Linear in the total size of the patterns.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @return The id of the first new rule,
+        which is equal to the previous
+        value of @ref size.
+
+        @param first The first pattern in the range.
+
+        @param last One past the last pattern in the range.
+    */
+    template<class FwdIt>
+    std::size_t
+    add(
+        FwdIt first,
+        FwdIt last)
+    {
+        auto const id = v_.size();
+        v_.insert(v_.end(), first, last);
+        try
+        {
+            build();
+        }
+        catch(...)
+        {
+            v_.erase(v_.begin() + id, v_.end());
+            throw;
+        }
+        return id;
+    }
+
+    /** Find the rules matching a url
+
+        The ids of all the rules which match
+        the url are appended to `ids`, in
+        ascending order.
+
+        @par Complexity
+        Linear in `u.size()` times the total
+        size of the patterns, divided by 64,
+        plus the number of rules.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+
+        @param u The url to match.
+
+        @param ids The container to which the
+        ids are appended.
+    */
+    void
+    match(
+        url_view_base const& u,
+        std::vector<std::size_t>& ids) const;
+};
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,167 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_SCANNER_HPP
+#define BOOST_URL_URL_SCANNER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/optional.hpp>
+
+namespace boost {
+namespace urls {
+
+/** A scanner which finds URLs in free text
+
+    Objects of this type search text, such as
+    the body of a message or an HTML document,
+    for the urls it contains. Each url found is
+    returned as a @ref url_view which references
+    the original text; no characters are copied
+    and no memory is allocated.
+
+    Candidates are located by searching for
+    a scheme followed by "://", such as
+    "https://", and for host names beginning
+    with "www.". From the candidate, the span
+    extends over the characters which may
+    appear in a url, and the longest prefix of
+    the span which is a valid <em>URI</em> is
+    returned. When the url is immediately
+    preceded by '<', '"', or '\'', and the
+    span ends at the matching delimiter, the
+    span is used as-is. Otherwise, trailing
+    punctuation such as a period ending a
+    sentence, or a closing parenthesis which
+    is not balanced within the url, is
+    excluded.
+
+    A url beginning with "www." has no scheme
+    and no "//", so it cannot be returned with
+    an authority. It is returned as a
+    <em>relative-ref</em> whose path holds the
+    host and path, for which `has_scheme()` and
+    `has_authority()` return `false`. Since a
+    relative-ref cannot hold a port, when the
+    host is followed by a port, only the host
+    is returned: the port, and the path, query,
+    and fragment after it, are lost. The
+    scanner still skips them, and the whole
+    text of the url ends at @ref offset.
+
+    A candidate with a scheme but no host,
+    other than a "file" url, is not returned,
+    and the text it spans is not searched
+    again for urls.
+
+    The search for candidates examines sixteen
+    characters at a time where SSE2 is available.
+
+    @par Example
+    @code
+    url_scanner sc( "See <https://www.example.com/a?b=c> or www.boost.org." );
+    std::vector< core::string_view > v;
+    while( auto u = sc.next() )
+        v.push_back( u->buffer() );
+
+    assert( v.size() == 2 );
+    assert( v[0] == "https://www.example.com/a?b=c" );
+    assert( v[1] == "www.boost.org" );
+    @endcode
+
+    @see
+        @ref parse_uri,
+        @ref uri_rule.
+*/
+class BOOST_URL_DECL url_scanner
+{
+    char const* first_;
+    char const* it_;
+    char const* end_;
+
+    // the last span of characters which
+    // may appear in a url
+    char const* span_first_;
+    char const* span_last_;
+
+    char const*
+    find_span(
+        char const* first,
+        char const* end,
+        bool& delimited) noexcept;
+
+public:
+    /** Constructor
+
+        The scanner references the characters
+        of `s`. The caller is responsible for
+        ensuring that the lifetime of the
+        buffer extends until it is no longer
+        referenced by the scanner, or by any
+        url it returns.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param s The text to scan.
+    */
+    explicit
+    url_scanner(
+        core::string_view s) noexcept
+        : first_(s.data())
+        , it_(s.data())
+        , end_(s.data() + s.size())
+        , span_first_(s.data())
+        , span_last_(s.data())
+    {
+    }
+
+    /** Return the next url in the text
+
+        Urls are returned in the order in which
+        they appear, and do not overlap.
+
+        @par Complexity
+        Linear in the number of characters
+        scanned.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The url, or an empty optional
+        if there are no more urls in the text.
+    */
+    boost::optional<url_view>
+    next() noexcept;
+
+    /** Return the offset of the scanner in the text
+
+        The next search for a url begins at
+        this position, which is just past the
+        text of the last url returned. This is
+        also past the end of its buffer when
+        the url begins with "www." and its host
+        is followed by a port.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    offset() const noexcept
+    {
+        return static_cast<
+            std::size_t>(it_ - first_);
+    }
+};
+
+} // urls
+} // boost
+
+#endif
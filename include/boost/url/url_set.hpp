@@ -0,0 +1,269 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_SET_HPP
+#define BOOST_URL_URL_SET_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** An immutable sorted set of URLs stored compactly
+
+    This container holds a sorted sequence of
+    distinct urls, ordered by their buffers,
+    in a compressed form suited to very large
+    collections whose urls share long
+    prefixes, such as the same scheme, host,
+    and leading path segments.
+
+    The urls are front coded in blocks of
+    @ref block_size. The first url of each
+    block is stored in full, and each following
+    url stores only the number of leading
+    characters it shares with the url before
+    it, and the remaining characters. With
+    each url the sizes of its parts, the
+    decoded sizes, and the other results of
+    parsing are stored as variable length
+    integers, so that a url is recovered
+    without parsing it again; these are
+    omitted when they are the same as for
+    the url before it. A sparse index
+    of the blocks allows lookups by binary
+    search followed by a scan of one block.
+
+    Iterating the set visits the urls in
+    order. Each @ref url_view obtained from an
+    iterator references storage owned by that
+    iterator, and remains valid until the
+    iterator is incremented, assigned, or
+    destroyed. To keep a url, copy it into a
+    @ref url or @ref static_url; this copies
+    the characters and the stored offsets
+    without parsing.
+
+    @par Example
+    @code
+    std::vector< url_view > v = {
+        url_view( "https://www.example.com/a/b/1" ),
+        url_view( "https://www.example.com/a/b/2" ),
+        url_view( "https://www.example.com/a/c" ) };
+    url_set us( v.begin(), v.end() );
+
+    assert( us.contains( "https://www.example.com/a/b/2" ) );
+
+    auto r = us.prefix_range( "https://www.example.com/a/b/" );
+    for( auto it = r.first; it != r.second; ++it )
+    {
+        url u( *it );
+        assert( u.segments().size() == 3 );
+    }
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.
+    Shared objects: Safe.
+
+    @see
+        @ref url_view.
+*/
+class BOOST_URL_DECL url_set
+{
+    std::string data_;
+    std::vector<std::size_t> index_;
+    std::size_t size_ = 0;
+
+    // used while building
+    std::string prev_;
+    std::string prev_meta_;
+
+    void append(url_view_base const&);
+    void finish();
+
+    std::size_t find_block(
+        core::string_view) const noexcept;
+
+public:
+    /** The number of urls in each block
+    */
+    static constexpr std::size_t block_size = 16;
+
+    /** A read-only iterator over the urls
+    */
+    class iterator;
+
+    /** A read-only iterator over the urls
+    */
+    using const_iterator = iterator;
+
+    /** Constructor
+
+        Default constructed sets are empty.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_set() noexcept = default;
+
+    /** Constructor
+
+        The set is built from the urls in
+        the range, which must be distinct and
+        sorted in ascending order of their
+        buffers.
+
+        @par Constraints
+        @code
+        std::is_convertible<
+            std::iterator_traits< FwdIt >::reference,
+            url_view_base const& >::value == true
+        @endcode
+
+        @par Complexity
+        Linear in the total size of the urls.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        The urls are not distinct and sorted.
+
+        @param first The first url in the range.
+
+        @param last One past the last url in the range.
+    */
+    template<class FwdIt>
+    url_set(
+        FwdIt first,
+        FwdIt last);
+
+    /** Return an iterator to the first url
+
+        @par Complexity
+        Linear in the size of the first url.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+    */
+    iterator
+    begin() const;
+
+    /** Return an iterator to the end
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    end() const noexcept;
+
+    /** Return true if the set is empty
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    /** Return the number of urls in the set
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    /** Return the number of bytes of memory used
+
+        This includes the compressed urls
+        and the index of blocks.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    memory_usage() const noexcept;
+
+    /** Return true if a url with the given buffer is present
+
+        The buffer is compared exactly, without
+        normalization.
+
+        @par Complexity
+        Logarithmic in `this->size()`, plus
+        a scan of one block.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param s The buffer of the url to look up.
+    */
+    bool
+    contains(core::string_view s) const;
+
+    /** Return an iterator to the first url not less than a string
+
+        Urls are compared with `s` by
+        their buffers.
+
+        @par Complexity
+        Logarithmic in `this->size()`, plus
+        a scan of one block.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param s The string to compare with.
+    */
+    iterator
+    lower_bound(core::string_view s) const;
+
+    /** Return the range of urls whose buffers begin with a prefix
+
+        @par Example
+        @code
+        auto r = us.prefix_range( "https://www.example.com/a/b/" );
+        @endcode
+
+        @par Complexity
+        Logarithmic in `this->size()`, plus
+        a scan of two blocks.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @return A pair of iterators denoting
+        the range.
+
+        @param prefix The prefix to match.
+    */
+    std::pair<iterator, iterator>
+    prefix_range(core::string_view prefix) const;
+};
+
+} // urls
+} // boost
+
+#include <boost/url/impl/url_set.hpp>
+
+#endif
@@ -38,6 +38,7 @@ namespace urls {
 #ifndef BOOST_URL_DOCS
 namespace detail {
 struct pattern;
+struct url_record;
 }
 #endif
 
@@ -54,6 +55,7 @@ struct pattern;
         @li @ref url
         @li @ref url_view
         @li @ref static_url
+        @li @ref small_url
 
     @par Functions
         @li @ref parse_absolute_uri
@@ -73,6 +75,7 @@ class BOOST_URL_DECL
     friend class url_base;
     friend class url_view;
     friend class static_url_base;
+    friend class small_url_base;
     friend class params_base;
     friend class params_encoded_base;
     friend class params_encoded_ref;
@@ -86,6 +89,9 @@ class BOOST_URL_DECL
     friend class segments_ref;
     friend class segments_view;
     friend struct detail::pattern;
+    friend struct detail::url_record;
+    friend class url_set;
+    friend class parse_cache;
 
     struct shared_impl;
 
@@ -0,0 +1,146 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/alloc_stats.hpp>
+#include "detail/alloc_stats.hpp"
+#include <atomic>
+
+namespace boost {
+namespace urls {
+
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+
+namespace detail {
+
+namespace {
+
+struct global_stats
+{
+    std::atomic<std::uint64_t> allocations{0};
+    std::atomic<std::uint64_t> reallocations{0};
+    std::atomic<std::uint64_t> bytes{0};
+    std::atomic<std::uint64_t> copied{0};
+    std::atomic<std::uint64_t> moved{0};
+    std::atomic<std::size_t> peak_capacity{0};
+};
+
+global_stats g_;
+
+} // (anon)
+
+void
+count_allocate(
+    alloc_stats& st,
+    std::size_t cap,
+    bool grow) noexcept
+{
+    ++st.allocations;
+    st.bytes += cap + 1;
+    if(grow)
+        ++st.reallocations;
+    if(st.peak_capacity < cap)
+        st.peak_capacity = cap;
+
+    g_.allocations.fetch_add(1,
+        std::memory_order_relaxed);
+    g_.bytes.fetch_add(cap + 1,
+        std::memory_order_relaxed);
+    if(grow)
+        g_.reallocations.fetch_add(1,
+            std::memory_order_relaxed);
+    auto peak = g_.peak_capacity.load(
+        std::memory_order_relaxed);
+    while( peak < cap &&
+        ! g_.peak_capacity.compare_exchange_weak(
+            peak, cap,
+            std::memory_order_relaxed))
+    {
+    }
+}
+
+void
+count_copy(
+    alloc_stats& st,
+    std::size_t n) noexcept
+{
+    st.copied += n;
+    g_.copied.fetch_add(n,
+        std::memory_order_relaxed);
+}
+
+void
+count_move(
+    alloc_stats& st,
+    std::size_t n) noexcept
+{
+    st.moved += n;
+    g_.moved.fetch_add(n,
+        std::memory_order_relaxed);
+}
+
+} // detail
+
+alloc_stats
+alloc_stats_snapshot() noexcept
+{
+    auto const& g = detail::g_;
+    alloc_stats st;
+    st.allocations = g.allocations.load(
+        std::memory_order_relaxed);
+    st.reallocations = g.reallocations.load(
+        std::memory_order_relaxed);
+    st.bytes = g.bytes.load(
+        std::memory_order_relaxed);
+    st.copied = g.copied.load(
+        std::memory_order_relaxed);
+    st.moved = g.moved.load(
+        std::memory_order_relaxed);
+    st.peak_capacity = g.peak_capacity.load(
+        std::memory_order_relaxed);
+    return st;
+}
+
+void
+alloc_stats_reset() noexcept
+{
+    auto& g = detail::g_;
+    g.allocations.store(0,
+        std::memory_order_relaxed);
+    g.reallocations.store(0,
+        std::memory_order_relaxed);
+    g.bytes.store(0,
+        std::memory_order_relaxed);
+    g.copied.store(0,
+        std::memory_order_relaxed);
+    g.moved.store(0,
+        std::memory_order_relaxed);
+    g.peak_capacity.store(0,
+        std::memory_order_relaxed);
+}
+
+#else
+
+alloc_stats
+alloc_stats_snapshot() noexcept
+{
+    return {};
+}
+
+void
+alloc_stats_reset() noexcept
+{
+}
+
+#endif
+
+} // urls
+} // boost
+
@@ -10,6 +10,7 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/authority_view.hpp>
+#include "detail/ipv6_text.hpp"
 #include "detail/normalize.hpp"
 #include <boost/url/grammar/parse.hpp>
 #include <boost/url/rfc/authority_rule.hpp>
@@ -387,9 +388,16 @@ compare(const authority_view& other) const noexcept
         }
     }
 
+    char buf0[detail::normalized_host_max];
+    char buf1[detail::normalized_host_max];
     comp = detail::ci_compare_encoded(
-        encoded_host(),
-        other.encoded_host());
+        detail::normalized_host(
+            encoded_host(), host_type(),
+            host_ipv6_address(), buf0),
+        detail::normalized_host(
+            other.encoded_host(),
+            other.host_type(),
+            other.host_ipv6_address(), buf1));
     if ( comp != 0 )
         return comp;
 
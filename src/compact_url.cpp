@@ -0,0 +1,384 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/compact_url.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/assert.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+/*  Layout of the allocation
+
+    N   scheme, if it is not well-known:
+        the size as a LEB128 integer,
+        then the characters in lower case
+    N   userinfo, if present: the size as
+        a LEB128 integer, then the characters
+    N   port, if present: the size in one
+        byte, then the characters
+    N   path, query, and fragment
+*/
+
+enum : unsigned char
+{
+    flag_authority = 1,
+    flag_userinfo = 2,
+    flag_port = 4,
+    flag_scheme = 8
+};
+
+char*
+put_varint(
+    char* p,
+    std::size_t v) noexcept
+{
+    while(v >= 0x80)
+    {
+        *p++ = static_cast<char>(
+            (v & 0x7f) | 0x80);
+        v >>= 7;
+    }
+    *p++ = static_cast<char>(v);
+    return p;
+}
+
+std::size_t
+varint_size(std::size_t v) noexcept
+{
+    std::size_t n = 1;
+    while(v >= 0x80)
+    {
+        v >>= 7;
+        ++n;
+    }
+    return n;
+}
+
+core::string_view
+get_string(char const*& p) noexcept
+{
+    std::size_t n = 0;
+    int shift = 0;
+    for(;;)
+    {
+        auto const b = static_cast<
+            unsigned char>(*p++);
+        n |= static_cast<std::size_t>(
+            b & 0x7f) << shift;
+        if(b < 0x80)
+            break;
+        shift += 7;
+    }
+    core::string_view s(p, n);
+    p += n;
+    return s;
+}
+
+// the parts of the allocation
+struct fields
+{
+    core::string_view scheme;
+    core::string_view userinfo;
+    core::string_view port;
+    core::string_view resource;
+};
+
+fields
+split(
+    char const* p,
+    std::size_t n,
+    unsigned char flags) noexcept
+{
+    fields f;
+    char const* const end = p + n;
+    if(flags & flag_scheme)
+        f.scheme = get_string(p);
+    if(flags & flag_userinfo)
+        f.userinfo = get_string(p);
+    if(flags & flag_port)
+    {
+        auto const len = static_cast<
+            unsigned char>(*p++);
+        f.port = core::string_view(p, len);
+        p += len;
+    }
+    f.resource = core::string_view(
+        p, end - p);
+    return f;
+}
+
+} // (anon)
+
+//------------------------------------------------
+
+compact_url::
+compact_url(
+    url_view_base const& u,
+    host_interner& hi)
+{
+    if(u.size() > 0xffffffff)
+        detail::throw_length_error();
+    core::string_view const scheme =
+        u.scheme_id() == urls::scheme::unknown ?
+            u.scheme() : core::string_view();
+    core::string_view const userinfo =
+        u.has_userinfo() ?
+            core::string_view(u.encoded_userinfo()) :
+            core::string_view();
+    core::string_view const port = u.port();
+    core::string_view const resource =
+        u.encoded_resource();
+
+    unsigned char flags = 0;
+    std::size_t n = resource.size();
+    if(u.has_authority())
+        flags |= flag_authority;
+    if(! scheme.empty())
+    {
+        flags |= flag_scheme;
+        n += varint_size(scheme.size()) +
+            scheme.size();
+    }
+    if(u.has_userinfo())
+    {
+        flags |= flag_userinfo;
+        n += varint_size(userinfo.size()) +
+            userinfo.size();
+    }
+    if(u.has_port())
+    {
+        // the port is at most 5 digits
+        // when the number is known, but
+        // may be longer when it is not
+        if(port.size() > 255)
+            detail::throw_length_error();
+        flags |= flag_port;
+        n += 1 + port.size();
+    }
+
+    auto const host = hi.intern(
+        u.encoded_host());
+    std::unique_ptr<char[]> p;
+    if(n != 0)
+    {
+        p.reset(new char[n]);
+        char* it = p.get();
+        if(flags & flag_scheme)
+        {
+            it = put_varint(it, scheme.size());
+            for(char c : scheme)
+                *it++ = grammar::to_lower(c);
+        }
+        if(flags & flag_userinfo)
+        {
+            it = put_varint(it, userinfo.size());
+            std::memcpy(it,
+                userinfo.data(), userinfo.size());
+            it += userinfo.size();
+        }
+        if(flags & flag_port)
+        {
+            *it++ = static_cast<char>(port.size());
+            std::memcpy(it,
+                port.data(), port.size());
+            it += port.size();
+        }
+        if(! resource.empty())
+            std::memcpy(it,
+                resource.data(), resource.size());
+        it += resource.size();
+        BOOST_ASSERT(
+            static_cast<std::size_t>(
+                it - p.get()) == n);
+    }
+    p_ = std::move(p);
+    n_ = static_cast<std::uint32_t>(n);
+    host_ = host;
+    port_ = u.port_number();
+    scheme_ = u.scheme_id();
+    flags_ = flags;
+}
+
+compact_url::
+compact_url(
+    compact_url const& other)
+    : n_(other.n_)
+    , host_(other.host_)
+    , port_(other.port_)
+    , scheme_(other.scheme_)
+    , flags_(other.flags_)
+{
+    if(n_ != 0)
+    {
+        p_.reset(new char[n_]);
+        std::memcpy(p_.get(),
+            other.p_.get(), n_);
+    }
+}
+
+compact_url::
+compact_url(
+    compact_url&& other) noexcept
+    : p_(std::move(other.p_))
+    , n_(other.n_)
+    , host_(other.host_)
+    , port_(other.port_)
+    , scheme_(other.scheme_)
+    , flags_(other.flags_)
+{
+    other.n_ = 0;
+    other.host_ = 0;
+    other.port_ = 0;
+    other.scheme_ = scheme::none;
+    other.flags_ = 0;
+}
+
+compact_url&
+compact_url::
+operator=(compact_url const& other)
+{
+    if(this != &other)
+        *this = compact_url(other);
+    return *this;
+}
+
+compact_url&
+compact_url::
+operator=(compact_url&& other) noexcept
+{
+    if(this == &other)
+        return *this;
+    p_ = std::move(other.p_);
+    n_ = other.n_;
+    host_ = other.host_;
+    port_ = other.port_;
+    scheme_ = other.scheme_;
+    flags_ = other.flags_;
+    other.n_ = 0;
+    other.host_ = 0;
+    other.port_ = 0;
+    other.scheme_ = scheme::none;
+    other.flags_ = 0;
+    return *this;
+}
+
+pct_string_view
+compact_url::
+encoded_resource() const noexcept
+{
+    auto const f = split(
+        p_.get(), n_, flags_);
+    // the characters were valid when stored
+    return make_pct_string_view(
+        f.resource).value();
+}
+
+std::size_t
+compact_url::
+size(host_interner const& hi) const noexcept
+{
+    auto const f = split(
+        p_.get(), n_, flags_);
+    std::size_t n = f.resource.size();
+    if(flags_ & flag_scheme)
+        n += f.scheme.size() + 1;
+    else if(scheme_ != scheme::none)
+        n += to_string(scheme_).size() + 1;
+    if(flags_ & flag_authority)
+    {
+        n += 2 + hi.host(host_).size();
+        if(flags_ & flag_userinfo)
+            n += f.userinfo.size() + 1;
+        if(flags_ & flag_port)
+            n += f.port.size() + 1;
+    }
+    return n;
+}
+
+std::size_t
+compact_url::
+write(
+    host_interner const& hi,
+    char* dest) const noexcept
+{
+    auto const f = split(
+        p_.get(), n_, flags_);
+    auto const append = [&dest](
+        core::string_view s)
+    {
+        if(s.empty())
+            return;
+        std::memcpy(dest, s.data(), s.size());
+        dest += s.size();
+    };
+    char* const begin = dest;
+    if(flags_ & flag_scheme)
+    {
+        append(f.scheme);
+        *dest++ = ':';
+    }
+    else if(scheme_ != scheme::none)
+    {
+        append(to_string(scheme_));
+        *dest++ = ':';
+    }
+    if(flags_ & flag_authority)
+    {
+        append("//");
+        if(flags_ & flag_userinfo)
+        {
+            append(f.userinfo);
+            *dest++ = '@';
+        }
+        append(hi.host(host_));
+        if(flags_ & flag_port)
+        {
+            *dest++ = ':';
+            append(f.port);
+        }
+    }
+    append(f.resource);
+    return dest - begin;
+}
+
+url_view
+compact_url::
+view(
+    host_interner const& hi,
+    std::string& buf) const
+{
+    buf.resize(size(hi));
+    auto const n = write(hi, &buf[0]);
+    BOOST_ASSERT(n == buf.size());
+    (void)n;
+    auto rv = parse_uri_reference(buf);
+    // the parts were valid when stored
+    BOOST_ASSERT(! rv.has_error());
+    return *rv;
+}
+
+url
+compact_url::
+to_url(host_interner const& hi) const
+{
+    std::string buf;
+    return url(view(hi, buf));
+}
+
+} // urls
+} // boost
+
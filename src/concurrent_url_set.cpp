@@ -0,0 +1,327 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/concurrent_url_set.hpp>
+#include <boost/url/serialize.hpp>
+#include <boost/url/url_hash.hpp>
+#include <boost/url/detail/except.hpp>
+#include "detail/arena.hpp"
+#include "detail/mutex.hpp"
+#include "detail/normalize.hpp"
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// blocks of 512 bits, one cache line
+constexpr std::size_t filter_block = 512;
+constexpr std::size_t filter_words =
+    filter_block / 64;
+
+// size of the blocks holding the
+// serialized urls stored in a shard
+constexpr std::size_t arena_block = 64 * 1024;
+
+// compute the bits set in a filter
+// block for the digest `h`, and return
+// the index of the first word
+std::size_t
+filter_masks(
+    std::size_t h,
+    std::size_t nblocks,
+    std::size_t k,
+    std::uint64_t* masks) noexcept
+{
+    std::uint64_t const m = detail::mix_hash(h);
+    // multiply-shift maps the upper bits
+    // onto [0, nblocks) without a division
+    std::size_t const block =
+        static_cast<std::size_t>(
+            ((m >> 32) * nblocks) >> 32);
+    for(std::size_t i = 0;
+            i < filter_words; ++i)
+        masks[i] = 0;
+    // each bit uses 9 bits of g
+    std::uint64_t g = m;
+    for(std::size_t i = 0; i < k; ++i)
+    {
+        if(i % 7 == 0)
+            g = detail::mix_hash(g + i + 1);
+        auto const bit = g & (filter_block - 1);
+        g >>= 9;
+        masks[bit >> 6] |=
+            std::uint64_t(1) << (bit & 63);
+    }
+    return block * filter_words;
+}
+
+} // (anon)
+
+//------------------------------------------------
+
+struct concurrent_url_set::shard
+{
+    struct slot
+    {
+        std::size_t hash;
+        char const* rec;
+        std::size_t len;
+    };
+
+    detail::mutex m;
+    std::unique_ptr<slot[]> slots;
+    std::size_t cap = 0;
+    std::size_t n = 0;
+
+    detail::arena<arena_block> chars;
+
+    static
+    bool
+    equal(
+        slot const& s,
+        url_view_base const& u) noexcept
+    {
+        char const* it = s.rec;
+        auto rv = deserialize_url(
+            it, s.rec + s.len);
+        return rv && *rv == u;
+    }
+
+    // return the slot holding a url
+    // equivalent to u, or the empty
+    // slot where it would be inserted
+    slot*
+    find(
+        std::size_t h,
+        std::uint64_t m,
+        url_view_base const& u) const noexcept
+    {
+        if(cap == 0)
+            return nullptr;
+        std::size_t const mask = cap - 1;
+        std::size_t i = static_cast<
+            std::size_t>(m) & mask;
+        for(;;)
+        {
+            slot& s = slots[i];
+            if(! s.rec)
+                return &s;
+            if( s.hash == h &&
+                equal(s, u))
+                return &s;
+            i = (i + 1) & mask;
+        }
+    }
+
+    void
+    grow()
+    {
+        std::size_t const cap1 =
+            cap ? cap * 2 : 16;
+        std::unique_ptr<slot[]> slots1(
+            new slot[cap1]());
+        std::size_t const mask = cap1 - 1;
+        for(std::size_t j = 0; j < cap; ++j)
+        {
+            slot const& s = slots[j];
+            if(! s.rec)
+                continue;
+            std::size_t i = static_cast<std::size_t>(
+                detail::mix_hash(s.hash)) & mask;
+            while(slots1[i].rec)
+                i = (i + 1) & mask;
+            slots1[i] = s;
+        }
+        slots = std::move(slots1);
+        cap = cap1;
+    }
+
+    void
+    clear() noexcept
+    {
+        slots.reset();
+        cap = 0;
+        n = 0;
+        chars.clear();
+    }
+};
+
+//------------------------------------------------
+
+concurrent_url_set::
+~concurrent_url_set() = default;
+
+concurrent_url_set::
+concurrent_url_set()
+    : concurrent_url_set(options())
+{
+}
+
+concurrent_url_set::
+concurrent_url_set(
+    options const& opt)
+{
+    if( opt.shards == 0 ||
+        opt.filter_hashes == 0 ||
+        opt.filter_hashes > 16)
+        detail::throw_invalid_argument();
+    if(opt.filter_bits != 0)
+    {
+        std::size_t const nblocks =
+            (opt.filter_bits + filter_block - 1) /
+                filter_block;
+        std::size_t const nwords =
+            nblocks * filter_words;
+        bits_.reset(new std::atomic<
+            std::uint64_t>[nwords]);
+        for(std::size_t i = 0; i < nwords; ++i)
+            bits_[i].store(0,
+                std::memory_order_relaxed);
+        nbits_ = nblocks * filter_block;
+        k_ = opt.filter_hashes;
+        return;
+    }
+    std::size_t n = 1;
+    while(n < opt.shards)
+        n *= 2;
+    shards_.reset(new shard[n]);
+    shard_mask_ = n - 1;
+}
+
+bool
+concurrent_url_set::
+insert(url_view_base const& u)
+{
+    std::size_t const h = url_hash()(u);
+    if(is_filter())
+    {
+        std::uint64_t masks[filter_words];
+        std::size_t const w = filter_masks(
+            h, nbits_ / filter_block, k_, masks);
+        bool inserted = false;
+        for(std::size_t i = 0;
+                i < filter_words; ++i)
+        {
+            if(! masks[i])
+                continue;
+            auto const prev = bits_[w + i].fetch_or(
+                masks[i], std::memory_order_relaxed);
+            if((prev & masks[i]) != masks[i])
+                inserted = true;
+        }
+        if(inserted)
+            size_.fetch_add(1,
+                std::memory_order_relaxed);
+        return inserted;
+    }
+
+    std::uint64_t const m = detail::mix_hash(h);
+    // the upper bits select the shard, the
+    // lower bits select the slot within it
+    shard& sh = shards_[static_cast<
+        std::size_t>(m >> 40) & shard_mask_];
+    detail::lock lock(sh.m);
+    auto* s = sh.find(h, m, u);
+    if(s && s->rec)
+        return false;
+    std::size_t const len =
+        serialized_size(u);
+    if((sh.n + 1) * 4 > sh.cap * 3)
+    {
+        sh.grow();
+        s = sh.find(h, m, u);
+    }
+    char* p = sh.chars.allocate(len);
+    if(serialize_url(p, len, u) == 0)
+        detail::throw_length_error();
+    s->hash = h;
+    s->rec = p;
+    s->len = len;
+    ++sh.n;
+    size_.fetch_add(1,
+        std::memory_order_relaxed);
+    return true;
+}
+
+bool
+concurrent_url_set::
+contains(
+    url_view_base const& u) const
+{
+    std::size_t const h = url_hash()(u);
+    if(is_filter())
+    {
+        std::uint64_t masks[filter_words];
+        std::size_t const w = filter_masks(
+            h, nbits_ / filter_block, k_, masks);
+        for(std::size_t i = 0;
+                i < filter_words; ++i)
+        {
+            if((bits_[w + i].load(
+                    std::memory_order_relaxed) &
+                        masks[i]) != masks[i])
+                return false;
+        }
+        return true;
+    }
+
+    std::uint64_t const m = detail::mix_hash(h);
+    shard& sh = shards_[static_cast<
+        std::size_t>(m >> 40) & shard_mask_];
+    detail::lock lock(sh.m);
+    auto const* s = sh.find(h, m, u);
+    return s && s->rec;
+}
+
+std::size_t
+concurrent_url_set::
+memory_usage() const
+{
+    if(is_filter())
+        return nbits_ / 8;
+    std::size_t n =
+        (shard_mask_ + 1) * sizeof(shard);
+    for(std::size_t i = 0;
+            i <= shard_mask_; ++i)
+    {
+        shard& sh = shards_[i];
+        detail::lock lock(sh.m);
+        n += sh.cap * sizeof(shard::slot) +
+            sh.chars.bytes();
+    }
+    return n;
+}
+
+void
+concurrent_url_set::
+clear() noexcept
+{
+    if(is_filter())
+    {
+        for(std::size_t i = 0,
+                n = nbits_ / 64; i < n; ++i)
+            bits_[i].store(0,
+                std::memory_order_relaxed);
+    }
+    else
+    {
+        for(std::size_t i = 0;
+                i <= shard_mask_; ++i)
+            shards_[i].clear();
+    }
+    size_.store(0,
+        std::memory_order_relaxed);
+}
+
+} // urls
+} // boost
+
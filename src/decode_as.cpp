@@ -0,0 +1,387 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/decode_as.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/grammar/digit_chars.hpp>
+#include "detail/decode.hpp"
+#include <cmath>
+#include <limits>
+
+#if __cplusplus >= 201703L || \
+    (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+# if defined(__has_include)
+#  if __has_include(<charconv>)
+#   include <charconv>
+#  endif
+# endif
+#endif
+
+#if defined(__cpp_lib_to_chars) && \
+    __cpp_lib_to_chars >= 201611L
+# define BOOST_URL_FROM_CHARS_FLOAT
+#else
+# include <cerrno>
+# include <cstdlib>
+# include <locale.h>
+# if defined(__APPLE__) || defined(__FreeBSD__)
+#  include <xlocale.h>
+# endif
+#endif
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+system::result<core::string_view>
+decode_as_chars(
+    pct_string_view s,
+    encoding_opts opt,
+    char* dest,
+    std::size_t n) noexcept
+{
+    if( s.decoded_size() == s.size() &&
+        ( ! opt.space_as_plus ||
+          s.find('+') == core::string_view::npos))
+    {
+        // nothing to decode
+        return s.substr();
+    }
+    if(s.decoded_size() > n)
+    {
+        // too long for any value
+        BOOST_URL_RETURN_EC(
+            grammar::error::out_of_range);
+    }
+    auto const dn = decode_unsafe(
+        dest, dest + n, s, opt);
+    return core::string_view(dest, dn);
+}
+
+system::result<bool>
+decode_as_bool(
+    pct_string_view s,
+    encoding_opts opt) noexcept
+{
+    char buf[8];
+    auto rv = decode_as_chars(
+        s, opt, buf, sizeof(buf));
+    if(rv)
+    {
+        core::string_view const d = *rv;
+        if( d == "1" ||
+            grammar::ci_is_equal(d, "true") ||
+            grammar::ci_is_equal(d, "yes") ||
+            grammar::ci_is_equal(d, "on"))
+            return true;
+        if( d == "0" ||
+            grammar::ci_is_equal(d, "false") ||
+            grammar::ci_is_equal(d, "no") ||
+            grammar::ci_is_equal(d, "off"))
+            return false;
+    }
+    BOOST_URL_RETURN_EC(
+        grammar::error::mismatch);
+}
+
+namespace {
+
+// Validates the decimal float syntax
+// of the string `s`, so that the
+// conversion sees no other input.
+system::result<void>
+check_float(
+    char const* s,
+    std::size_t n) noexcept
+{
+    char const* it = s;
+    char const* const end = s + n;
+    if( it != end &&
+        (*it == '-' || *it == '+'))
+        ++it;
+    std::size_t digits = 0;
+    while( it != end &&
+        grammar::digit_chars(*it))
+    {
+        ++it;
+        ++digits;
+    }
+    if( it != end &&
+        *it == '.')
+    {
+        ++it;
+        while( it != end &&
+            grammar::digit_chars(*it))
+        {
+            ++it;
+            ++digits;
+        }
+    }
+    if(digits == 0)
+    {
+        // expected digit
+        BOOST_URL_RETURN_EC(
+            grammar::error::mismatch);
+    }
+    if( it != end &&
+        (*it == 'e' || *it == 'E'))
+    {
+        ++it;
+        if( it != end &&
+            (*it == '-' || *it == '+'))
+            ++it;
+        if( it == end ||
+            ! grammar::digit_chars(*it))
+        {
+            // expected exponent
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        }
+        while( it != end &&
+            grammar::digit_chars(*it))
+            ++it;
+    }
+    if(it != end)
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::leftover);
+    }
+    return {};
+}
+
+#ifdef BOOST_URL_FROM_CHARS_FLOAT
+
+// return true if the decimal float `s`,
+// which is not zero and out of range, is
+// below one, so that it underflows
+bool
+is_tiny(
+    char const* s,
+    std::size_t n) noexcept
+{
+    char const* it = s;
+    char const* const end = s + n;
+    if( *it == '-' ||
+        *it == '+')
+        ++it;
+    // the power of ten of the
+    // leading nonzero digit
+    long k = 0;
+    bool nz = false;
+    while( it != end &&
+        grammar::digit_chars(*it))
+    {
+        nz = nz || *it != '0';
+        if(nz)
+            ++k;
+        ++it;
+    }
+    if( it != end &&
+        *it == '.')
+    {
+        ++it;
+        while( ! nz &&
+            it != end &&
+            *it == '0')
+        {
+            --k;
+            ++it;
+        }
+        while( it != end &&
+            grammar::digit_chars(*it))
+            ++it;
+    }
+    if(it == end)
+        return k <= 0;
+    // the exponent saturates, since
+    // any larger one is out of range
+    ++it;
+    bool neg = false;
+    if( *it == '-' ||
+        *it == '+')
+        neg = *it++ == '-';
+    long e = 0;
+    while(it != end)
+    {
+        if(e < 100000)
+            e = 10 * e + (*it - '0');
+        ++it;
+    }
+    return neg ? k - e <= 0 : k + e <= 0;
+}
+
+template<class T>
+system::result<T>
+to_float(
+    char const* s,
+    std::size_t n) noexcept
+{
+    // the conversion uses the "C" locale,
+    // does not allocate, and is correctly
+    // rounded, but does not accept '+'
+    char const* first = s;
+    if(*first == '+')
+        ++first;
+    T v = 0;
+    auto const r = std::from_chars(
+        first, s + n, v);
+    if(r.ec == std::errc::result_out_of_range)
+    {
+        if(! is_tiny(s, n))
+        {
+            BOOST_URL_RETURN_EC(
+                grammar::error::out_of_range);
+        }
+        // an underflow is zero
+        return *s == '-' ? -T(0) : T(0);
+    }
+    BOOST_ASSERT(r.ec == std::errc());
+    BOOST_ASSERT(r.ptr == s + n);
+    return v;
+}
+
+#else
+
+#ifdef _WIN32
+using c_locale_t = _locale_t;
+#else
+using c_locale_t = locale_t;
+#endif
+
+// return the "C" locale, which always
+// uses a period and no grouping, whatever
+// the global locale is. It is created
+// once, and only read.
+c_locale_t
+c_locale() noexcept
+{
+#ifdef _WIN32
+    static c_locale_t const loc =
+        _create_locale(LC_NUMERIC, "C");
+#else
+    static c_locale_t const loc =
+        newlocale(LC_NUMERIC_MASK, "C",
+            static_cast<c_locale_t>(0));
+#endif
+    return loc;
+}
+
+float
+strto(char const* s, char** end, float*) noexcept
+{
+#ifdef _WIN32
+    return _strtof_l(s, end, c_locale());
+#else
+    return strtof_l(s, end, c_locale());
+#endif
+}
+
+double
+strto(char const* s, char** end, double*) noexcept
+{
+#ifdef _WIN32
+    return _strtod_l(s, end, c_locale());
+#else
+    return strtod_l(s, end, c_locale());
+#endif
+}
+
+long double
+strto(char const* s, char** end, long double*) noexcept
+{
+#ifdef _WIN32
+    return _strtold_l(s, end, c_locale());
+#else
+    return strtold_l(s, end, c_locale());
+#endif
+}
+
+template<class T>
+system::result<T>
+to_float(
+    char const* s,
+    std::size_t n) noexcept
+{
+    // the buffer is null-terminated
+    char* end;
+    errno = 0;
+    T const v = strto(s, &end,
+        static_cast<T*>(nullptr));
+    // an overflow returns the largest value;
+    // an underflow returns a tiny value
+    if( errno == ERANGE &&
+        std::fabs(v) >= (
+            std::numeric_limits<T>::max)())
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::out_of_range);
+    }
+    BOOST_ASSERT(end == s + n);
+    (void)n;
+    return v;
+}
+
+#endif
+
+template<class T>
+system::result<T>
+decode_as_float_impl(
+    pct_string_view s,
+    encoding_opts opt) noexcept
+{
+    // one more for the null
+    char buf[decode_as_max_size + 1] = {};
+    if(s.decoded_size() > decode_as_max_size)
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::out_of_range);
+    }
+    auto const n = decode_unsafe(
+        buf, buf + decode_as_max_size, s, opt);
+    auto rv = check_float(buf, n);
+    if(! rv)
+        return rv.error();
+    return to_float<T>(buf, n);
+}
+
+} // (anon)
+
+system::result<float>
+decode_as_float(
+    pct_string_view s,
+    encoding_opts opt,
+    float*) noexcept
+{
+    return decode_as_float_impl<float>(s, opt);
+}
+
+system::result<double>
+decode_as_float(
+    pct_string_view s,
+    encoding_opts opt,
+    double*) noexcept
+{
+    return decode_as_float_impl<double>(s, opt);
+}
+
+system::result<long double>
+decode_as_float(
+    pct_string_view s,
+    encoding_opts opt,
+    long double*) noexcept
+{
+    return decode_as_float_impl<long double>(s, opt);
+}
+
+} // detail
+} // urls
+} // boost
+
@@ -0,0 +1,51 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_ALLOC_STATS_HPP
+#define BOOST_URL_DETAIL_ALLOC_STATS_HPP
+
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+
+#include <boost/url/alloc_stats.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Each function updates the counters of
+// one url and the global counters.
+
+// a buffer of cap characters was allocated;
+// `grow` is true if it replaces another one
+void
+count_allocate(
+    alloc_stats& st,
+    std::size_t cap,
+    bool grow) noexcept;
+
+// n characters were copied to a new buffer
+void
+count_copy(
+    alloc_stats& st,
+    std::size_t n) noexcept;
+
+// n characters were moved within a buffer
+void
+count_move(
+    alloc_stats& st,
+    std::size_t n) noexcept;
+
+} // detail
+} // urls
+} // boost
+
+#endif
+
+#endif
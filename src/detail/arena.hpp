@@ -0,0 +1,84 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_ARENA_HPP
+#define BOOST_URL_DETAIL_ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// characters allocated from blocks of
+// BlockSize, which are only freed
+// together when the arena is cleared
+template<std::size_t BlockSize>
+class arena
+{
+    std::vector<std::unique_ptr<char[]>> blocks_;
+    char* cur_ = nullptr;
+    std::size_t left_ = 0;
+    std::size_t bytes_ = 0;
+
+    char*
+    add_block(std::size_t size)
+    {
+        std::unique_ptr<char[]> b(
+            new char[size]);
+        blocks_.push_back(std::move(b));
+        bytes_ += size;
+        return blocks_.back().get();
+    }
+
+public:
+    // return the number of bytes
+    // in all the blocks
+    std::size_t
+    bytes() const noexcept
+    {
+        return bytes_;
+    }
+
+    char*
+    allocate(std::size_t size)
+    {
+        // large requests get their own
+        // block, leaving the current
+        // one in use
+        if(size > BlockSize / 4)
+            return add_block(size);
+        if(size > left_)
+        {
+            cur_ = add_block(BlockSize);
+            left_ = BlockSize;
+        }
+        char* p = cur_;
+        cur_ += size;
+        left_ -= size;
+        return p;
+    }
+
+    void
+    clear() noexcept
+    {
+        blocks_.clear();
+        cur_ = nullptr;
+        left_ = 0;
+        bytes_ = 0;
+    }
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_DECODED_LABEL_HPP
+#define BOOST_URL_DETAIL_DECODED_LABEL_HPP
+
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Tries whose edges are host labels or path
+// segments, compared after decoding, keep the
+// children of all nodes in one hash table
+// keyed by the parent and the decoded label.
+
+// invoke f with each decoded character of
+// the valid percent-encoded string s
+template<class F>
+void
+for_each_decoded(
+    core::string_view s,
+    bool icase,
+    F const& f)
+{
+    auto it = s.data();
+    auto const end = it + s.size();
+    while(it != end)
+    {
+        char c = *it++;
+        if(c == '%')
+        {
+            c = static_cast<char>(
+                (grammar::hexdig_value(it[0]) << 4) +
+                grammar::hexdig_value(it[1]));
+            it += 2;
+        }
+        if(icase)
+            c = grammar::to_lower(c);
+        f(c);
+    }
+}
+
+// FNV-1a with 32 bits, so that
+// stored hashes are portable
+inline
+std::uint32_t
+hash_label(
+    std::uint32_t parent,
+    core::string_view s,
+    bool icase) noexcept
+{
+    std::uint32_t h = 0x811C9DC5;
+    auto const put = [&h](unsigned char c)
+    {
+        h ^= c;
+        h *= 0x01000193;
+    };
+    for(int i = 0; i < 32; i += 8)
+        put(static_cast<unsigned char>(
+            parent >> i));
+    for_each_decoded(s, icase,
+        [&put](char c)
+        {
+            put(static_cast<
+                unsigned char>(c));
+        });
+    return h;
+}
+
+// return true if the decoded label
+// `d` is the decoding of `s`
+inline
+bool
+equal_decoded(
+    core::string_view d,
+    core::string_view s,
+    bool icase) noexcept
+{
+    if(d.size() > s.size())
+        return false;
+    auto it = d.data();
+    auto const end = it + d.size();
+    bool eq = true;
+    for_each_decoded(s, icase,
+        [&](char c)
+        {
+            eq = eq && it != end && *it++ == c;
+        });
+    return eq && it == end;
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,213 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/glob_nfa.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+namespace {
+
+enum : unsigned char
+{
+    tok_char,
+    tok_star,       // *
+    tok_any         // **
+};
+
+struct token
+{
+    unsigned char kind;
+    char c;
+};
+
+// class of '/', which `*` does not match
+constexpr std::uint16_t slash_class = 1;
+
+void
+tokenize(
+    core::string_view s,
+    bool icase,
+    std::vector<token>& v)
+{
+    auto it = s.data();
+    auto const end = it + s.size();
+    while(it != end)
+    {
+        if(*it == '*')
+        {
+            auto const p = it;
+            while(it != end && *it == '*')
+                ++it;
+            v.push_back({ static_cast<unsigned char>(
+                it - p > 1 ? tok_any : tok_star), 0 });
+            continue;
+        }
+        if(*it == '\\')
+        {
+            ++it;
+            if(it == end)
+                detail::throw_invalid_argument();
+        }
+        v.push_back({ tok_char, icase ?
+            grammar::to_lower(*it) : *it });
+        ++it;
+    }
+}
+
+void
+set_bit(
+    std::uint64_t* p,
+    std::size_t i) noexcept
+{
+    p[i / 64] |= std::uint64_t(1) << (i % 64);
+}
+
+} // (anon)
+
+void
+glob_nfa::
+build(
+    core::string_view const* patterns,
+    std::size_t n,
+    bool icase)
+{
+    std::vector<std::vector<token>> toks(n);
+    std::size_t states = 0;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        tokenize(patterns[i], icase, toks[i]);
+        states += toks[i].size() + 1;
+    }
+
+    // each character appearing in a pattern
+    // gets its own class, and the rest share
+    // class zero
+    std::uint16_t cls[256] = {};
+    cls[static_cast<unsigned char>('/')] =
+        slash_class;
+    std::size_t nclass = slash_class + 1;
+    for(auto const& v : toks)
+    {
+        for(auto const& t : v)
+        {
+            if(t.kind != tok_char)
+                continue;
+            auto const c = static_cast<
+                unsigned char>(t.c);
+            if(cls[c] != 0)
+                continue;
+            cls[c] = static_cast<
+                std::uint16_t>(nclass++);
+            if(icase)
+                cls[static_cast<unsigned char>(
+                    grammar::to_upper(t.c))] = cls[c];
+        }
+    }
+
+    std::size_t const words = (states + 63) / 64;
+    std::vector<std::uint64_t> adv(nclass * words, 0);
+    std::vector<std::uint64_t> stay(nclass * words, 0);
+    std::vector<std::uint64_t> eps(words, 0);
+    std::vector<std::uint64_t> start(words, 0);
+    std::vector<std::size_t> fin;
+    fin.reserve(n);
+    std::size_t b = 0;
+    for(auto const& v : toks)
+    {
+        set_bit(start.data(), b);
+        if( ! v.empty() &&
+            v[0].kind != tok_char)
+            set_bit(start.data(), b + 1);
+        for(std::size_t i = 0; i < v.size(); ++i)
+        {
+            auto const& t = v[i];
+            if(t.kind == tok_char)
+            {
+                set_bit(adv.data() + words * cls[
+                    static_cast<unsigned char>(t.c)],
+                        b + i);
+                continue;
+            }
+            set_bit(eps.data(), b + i);
+            for(std::size_t k = 0; k < nclass; ++k)
+                if( t.kind == tok_any ||
+                    k != slash_class)
+                    set_bit(stay.data() +
+                        words * k, b + i);
+        }
+        b += v.size();
+        fin.push_back(b);
+        ++b;
+    }
+
+    std::memcpy(cls_, cls, sizeof(cls));
+    nclass_ = nclass;
+    words_ = words;
+    adv_ = std::move(adv);
+    stay_ = std::move(stay);
+    eps_ = std::move(eps);
+    start_ = std::move(start);
+    final_ = std::move(fin);
+}
+
+std::uint64_t const*
+glob_nfa::
+run(
+    core::string_view s,
+    std::uint64_t* buf) const noexcept
+{
+    if(words_ == 0)
+        return nullptr;
+    std::uint64_t* cur = buf;
+    std::uint64_t* next = buf + words_;
+    std::copy(
+        start_.begin(), start_.end(), cur);
+    for(char c : s)
+    {
+        auto const k = cls_[
+            static_cast<unsigned char>(c)];
+        auto const adv = adv_.data() + k * words_;
+        auto const stay = stay_.data() + k * words_;
+        std::uint64_t ca = 0;
+        std::uint64_t ce = 0;
+        std::uint64_t any = 0;
+        for(std::size_t w = 0; w < words_; ++w)
+        {
+            // a star is never followed by
+            // another star, so one step of
+            // the closure is enough
+            auto const a = cur[w] & adv[w];
+            auto x = (a << 1) | ca |
+                (cur[w] & stay[w]);
+            ca = a >> 63;
+            auto const e = x & eps_[w];
+            x |= (e << 1) | ce;
+            ce = e >> 63;
+            next[w] = x;
+            any |= x;
+        }
+        if(any == 0)
+            return nullptr;
+        std::swap(cur, next);
+    }
+    return cur;
+}
+
+} // detail
+} // urls
+} // boost
+
@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include "ipv6_text.hpp"
+#include <boost/url/ipv4_address.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+namespace {
+
+// value of a hex digit, or 16
+inline
+unsigned
+hex_value(char c) noexcept
+{
+    unsigned d = static_cast<
+        unsigned char>(c) - '0';
+    if(d < 10)
+        return d;
+    d = (static_cast<unsigned char>(
+        c) | 0x20) - 'a';
+    if(d < 6)
+        return d + 10;
+    return 16;
+}
+
+} // (anon)
+
+bool
+parse_ipv6_text(
+    char const* it,
+    char const* const end,
+    ipv6_address::bytes_type& bytes) noexcept
+{
+    unsigned short w[8];
+    int n = 0;      // words seen
+    int gap = -1;   // value of n at "::"
+    if(it == end)
+        return false;
+    if(*it == ':')
+    {
+        if( end - it < 2 ||
+            it[1] != ':')
+            return false;
+        gap = 0;
+        it += 2;
+    }
+    while(it != end)
+    {
+        // h16
+        auto const first = it;
+        auto const last = (end - it > 4) ?
+            it + 4 : end;
+        unsigned v = 0;
+        while(it != last)
+        {
+            auto const d = hex_value(*it);
+            if(d > 15)
+                break;
+            v = (v << 4) | d;
+            ++it;
+        }
+        if(it == first)
+            return false;
+        if( it != end &&
+            *it == '.')
+        {
+            // ls32 as IPv4address
+            if(n > 6)
+                return false;
+            auto rv = parse_ipv4_address(
+                core::string_view(
+                    first, end - first));
+            if(! rv)
+                return false;
+            auto const v4 = rv->to_uint();
+            w[n++] = static_cast<
+                unsigned short>(v4 >> 16);
+            w[n++] = static_cast<
+                unsigned short>(v4 & 0xffff);
+            it = end;
+            break;
+        }
+        if(n == 8)
+            return false;
+        w[n++] = static_cast<
+            unsigned short>(v);
+        if(it == end)
+            break;
+        if(*it != ':')
+            return false;
+        if(++it == end)
+            return false;
+        if(*it == ':')
+        {
+            if(gap != -1)
+                return false;
+            gap = n;
+            ++it;
+        }
+    }
+    if(gap == -1)
+    {
+        if(n != 8)
+            return false;
+        gap = 8;
+    }
+    else if(n > 7)
+    {
+        // "::" stands for at
+        // least one word
+        return false;
+    }
+    std::memset(bytes.data(), 0, 16);
+    int i = 0;
+    for(; i < gap; ++i)
+    {
+        bytes[2 * i] = static_cast<
+            unsigned char>(w[i] >> 8);
+        bytes[2 * i + 1] = static_cast<
+            unsigned char>(w[i] & 0xff);
+    }
+    for(int j = 8 - (n - gap); i < n; ++i, ++j)
+    {
+        bytes[2 * j] = static_cast<
+            unsigned char>(w[i] >> 8);
+        bytes[2 * j + 1] = static_cast<
+            unsigned char>(w[i] & 0xff);
+    }
+    return true;
+}
+
+core::string_view
+normalized_host(
+    core::string_view host,
+    urls::host_type ht,
+    ipv6_address const& addr,
+    char* dest) noexcept
+{
+    if( ht != urls::host_type::ipv6 ||
+        host.find('%') !=
+            core::string_view::npos)
+        return host;
+    dest[0] = '[';
+    auto const s = addr.to_buffer(
+        dest + 1, ipv6_address::max_str_len);
+    dest[s.size() + 1] = ']';
+    return core::string_view(
+        dest, s.size() + 2);
+}
+
+} // detail
+} // urls
+} // boost
@@ -0,0 +1,56 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_IPV6_TEXT_HPP
+#define BOOST_URL_DETAIL_IPV6_TEXT_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/host_type.hpp>
+#include <boost/url/ipv6_address.hpp>
+#include <boost/core/detail/string_view.hpp>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Convert the IPv6 address text in
+// [first, last) to bytes in one pass.
+// Returns false if the whole range is not
+// an IPv6address; the grammar is then used
+// to obtain the precise error.
+BOOST_URL_DECL
+bool
+parse_ipv6_text(
+    char const* first,
+    char const* last,
+    ipv6_address::bytes_type& bytes) noexcept;
+
+// The size of the buffer required
+// by normalized_host.
+constexpr std::size_t normalized_host_max =
+    ipv6_address::max_str_len + 2;
+
+// Return the host as it compares after
+// normalization. IP-literals holding an
+// IPv6address are written in the RFC 5952
+// canonical form to `dest`, all other
+// hosts are returned unchanged.
+BOOST_URL_DECL
+core::string_view
+normalized_host(
+    core::string_view host,
+    urls::host_type ht,
+    ipv6_address const& addr,
+    char* dest) noexcept;
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,57 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_MUTEX_HPP
+#define BOOST_URL_DETAIL_MUTEX_HPP
+
+#include <boost/url/detail/config.hpp>
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <mutex>
+#endif
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// a mutex, which is empty and never
+// blocks when threads are disabled
+struct mutex
+{
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    std::mutex m;
+#endif
+};
+
+// holds the mutex for its lifetime
+class lock
+{
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    std::lock_guard<std::mutex> g_;
+
+public:
+    explicit
+    lock(mutex& m)
+        : g_(m.m)
+    {
+    }
+#else
+public:
+    explicit
+    lock(mutex&) noexcept
+    {
+    }
+#endif
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
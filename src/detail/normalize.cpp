@@ -190,74 +190,6 @@ ci_digest(
     }
 }
 
-/* Check if a string ends with the specified suffix (decoded comparison)
-
-   This function determines if a string ends with the specified suffix
-   when the string and suffix are compared after percent-decoding.
-
-   @param str The string to check (percent-encoded)
-   @param suffix The suffix to check for (percent-decoded)
-   @return The number of encoded chars consumed in the string
- */
-std::size_t
-path_ends_with(
-    core::string_view str,
-    core::string_view suffix) noexcept
-{
-    BOOST_ASSERT(!str.empty());
-    BOOST_ASSERT(!suffix.empty());
-    BOOST_ASSERT(!suffix.contains("%2F"));
-    BOOST_ASSERT(!suffix.contains("%2f"));
-    auto consume_last = [](
-        core::string_view::iterator& it,
-        core::string_view::iterator& end,
-        char& c)
-    {
-        BOOST_ASSERT(end > it);
-        BOOST_ASSERT(it != end);
-        if ((end - it) < 3 ||
-            *(std::prev(end, 3)) != '%')
-        {
-            c = *--end;
-            return false;
-        }
-        detail::decode_unsafe(
-            &c,
-            &c + 1,
-            core::string_view(std::prev(
-                end, 3), 3));
-        end -= 3;
-        return true;
-    };
-
-    auto it0 = str.begin();
-    auto end0 = str.end();
-    auto it1 = suffix.begin();
-    auto end1 = suffix.end();
-    char c0 = 0;
-    char c1 = 0;
-    while(
-        it0 < end0 &&
-        it1 < end1)
-    {
-        bool const is_encoded = consume_last(it0, end0, c0);
-        // The suffix never contains an encoded slash (%2F), and a decoded
-        // slash is not equivalent to an encoded slash
-        if (is_encoded && c0 == '/')
-            return 0;
-        consume_last(it1, end1, c1);
-        if (c0 != c1)
-            return 0;
-    }
-    bool const consumed_suffix = it1 == end1;
-    if (consumed_suffix)
-    {
-        std::size_t const consumed_encoded = str.end() - end0;
-        return consumed_encoded;
-    }
-    return 0;
-}
-
 std::size_t
 remove_dot_segments(
     char* dest0,
@@ -557,211 +489,71 @@ remove_dot_segments(
     return dest - dest0;
 }
 
-char
-path_pop_back( core::string_view& s )
-{
-    if (s.size() < 3 ||
-        *std::prev(s.end(), 3) != '%')
-    {
-        char c = s.back();
-        s.remove_suffix(1);
-        return c;
-    }
-    char c = 0;
-    detail::decode_unsafe(
-        &c, &c + 1, s.substr(s.size() - 3));
-    if (c != '/')
-    {
-        s.remove_suffix(3);
-        return c;
-    }
-    c = s.back();
-    s.remove_suffix(1);
-    return c;
-};
+namespace {
 
-void
-pop_last_segment(
-    core::string_view& str,
-    core::string_view& seg,
-    std::size_t& level,
-    bool remove_unmatched) noexcept
+// calculate path size as if it were normalized
+std::size_t
+normalized_size(
+    segments_encoded_view seg) noexcept
 {
-    seg = {};
-    std::size_t n = 0;
-    while (!str.empty())
-    {
-        // B.  if the input buffer begins with a
-        // prefix of "/./" or "/.", where "." is
-        // a complete path segment, then replace
-        // that prefix with "/" in the input
-        // buffer; otherwise,
-        n = detail::path_ends_with(str, "/./");
-        if (n)
-        {
-            seg = str.substr(str.size() - n);
-            str.remove_suffix(n);
-            continue;
-        }
-        n = detail::path_ends_with(str, "/.");
-        if (n)
-        {
-            seg = str.substr(str.size() - n, 1);
-            str.remove_suffix(n);
-            continue;
-        }
+    if (seg.empty())
+        return seg.is_absolute();
 
-        // C. if the input buffer begins with a
-        // prefix of "/../" or "/..", where ".."
-        // is a complete path segment, then
-        // replace that prefix with "/" in the
-        // input buffer and remove the last
-        // segment and its preceding "/"
-        // (if any) from the output buffer
-        // otherwise,
-        n = detail::path_ends_with(str, "/../");
-        if (n)
-        {
-            seg = str.substr(str.size() - n);
-            str.remove_suffix(n);
-            ++level;
-            continue;
-        }
-        n = detail::path_ends_with(str, "/..");
-        if (n)
-        {
-            seg = str.substr(str.size() - n);
-            str.remove_suffix(n);
-            ++level;
-            continue;
-        }
-
-        // E.  move the first path segment in the
-        // input buffer to the end of the output
-        // buffer, including the initial "/"
-        // character (if any) and any subsequent
-        // characters up to, but not including,
-        // the next "/" character or the end of
-        // the input buffer.
-        std::size_t p = str.size() > 1
-            ? str.find_last_of('/', str.size() - 2)
-            : core::string_view::npos;
-        if (p != core::string_view::npos)
-        {
-            seg = str.substr(p + 1);
-            str.remove_suffix(seg.size());
-        }
-        else
-        {
-            seg = str;
-            str = {};
-        }
-
-        if (level == 0)
-            return;
-        if (!str.empty())
-            --level;
-    }
-    // we still need to skip n_skip + 1
-    // but the string is empty
-    if (remove_unmatched && level)
-    {
-        seg = "/";
-        level = 0;
-        return;
-    }
-    else if (level)
-    {
-        if (!seg.empty())
-        {
-            seg = "/../";
-        }
-        else
+    std::size_t n = 0;
+    std::size_t skip = 0;
+    auto begin = seg.begin();
+    auto it = seg.end();
+    while (it != begin)
+    {
+        --it;
+        decode_view dseg = **it;
+        if (dseg == "..")
+            ++skip;
+        else if (dseg != ".")
         {
-            // AFREITAS: this condition
-            // is correct, but it might
-            // unreachable.
-            seg = "/..";
+            if (skip)
+                --skip;
+            else
+                n += dseg.size() + 1;
         }
-        --level;
-        return;
     }
-    seg = {};
+    n += skip * 3;
+    // a relative path made only of dot
+    // segments normalizes to the empty path
+    if (n != 0 && !seg.is_absolute())
+        --n;
+    return n;
 }
 
-void
-normalized_path_digest(
-    core::string_view str,
-    bool remove_unmatched,
-    fnv_1a& hasher) noexcept
+// produces the characters of a path, as
+// if it were normalized, from last to first
+struct reverse_normalized_path
 {
-    core::string_view seg;
-    std::size_t level = 0;
-    do
-    {
-        pop_last_segment(
-            str, seg, level, remove_unmatched);
-        while (!seg.empty())
-        {
-            char c = path_pop_back(seg);
-            hasher.put(c);
-        }
-    }
-    while (!str.empty());
-}
-
-// compare segments as if there were a normalized
-int
-segments_compare(
-    segments_encoded_view seg0,
-    segments_encoded_view seg1) noexcept
-{
-    // calculate path size as if it were normalized
-    auto normalized_size =
-        [](segments_encoded_view seg) -> std::size_t
-    {
-        if (seg.empty())
-            return seg.is_absolute();
-
-        std::size_t n = 0;
-        std::size_t skip = 0;
-        auto begin = seg.begin();
-        auto it = seg.end();
-        while (it != begin)
+    std::size_t n;
+    decode_view dseg;
+    segments_encoded_view::iterator begin;
+    segments_encoded_view::iterator it;
+    decode_view::iterator cit;
+    std::size_t skip = 0;
+    bool at_slash = true;
+
+    reverse_normalized_path(
+        segments_encoded_view seg) noexcept
+        : n(normalized_size(seg))
+        , begin(seg.begin())
+        , it(seg.end())
+    {
+        if (it != begin)
         {
             --it;
-            decode_view dseg = **it;
-            if (dseg == "..")
-                ++skip;
-            else if (dseg != ".")
-            {
-                if (skip)
-                    --skip;
-                else
-                    n += dseg.size() + 1;
-            }
+            dseg = **it;
         }
-        n += skip * 3;
-        n -= !seg.is_absolute();
-        return n;
-    };
-
-    // find the normalized size for the comparison
-    std::size_t n0 = normalized_size(seg0);
-    std::size_t n1 = normalized_size(seg1);
-    std::size_t n00 = n0;
-    std::size_t n10 = n1;
+        cit = dseg.end();
+    }
 
     // consume the last char from a segment range
-    auto consume_last =
-        [](
-            std::size_t& n,
-            decode_view& dseg,
-            segments_encoded_view::iterator& begin,
-            segments_encoded_view::iterator& it,
-            decode_view::iterator& cit,
-            std::size_t& skip,
-            bool& at_slash) -> char
+    char
+    pop_back() noexcept
     {
         if (cit != dseg.begin())
         {
@@ -842,51 +634,50 @@ segments_compare(
         // next segment
         at_slash = true;
         return '/';
-    };
+    }
+};
+
+} // (anon)
+
+// digest the same characters which
+// segments_compare compares, so that
+// equal paths have equal digests
+void
+normalized_path_digest(
+    segments_encoded_view seg,
+    fnv_1a& hasher) noexcept
+{
+    reverse_normalized_path p(seg);
+    while (p.n)
+        hasher.put(p.pop_back());
+}
+
+// compare segments as if there were a normalized
+int
+segments_compare(
+    segments_encoded_view seg0,
+    segments_encoded_view seg1) noexcept
+{
+    reverse_normalized_path p0(seg0);
+    reverse_normalized_path p1(seg1);
+    std::size_t const n00 = p0.n;
+    std::size_t const n10 = p1.n;
 
     // consume final segments from seg0 that
     // should not influence the comparison
-    auto begin0 = seg0.begin();
-    auto it0 = seg0.end();
-    decode_view dseg0;
-    if (it0 != seg0.begin())
-    {
-        --it0;
-        dseg0 = **it0;
-    }
-    decode_view::iterator cit0 = dseg0.end();
-    std::size_t skip0 = 0;
-    bool at_slash0 = true;
-    while (n0 > n1)
-    {
-        consume_last(n0, dseg0, begin0, it0, cit0, skip0, at_slash0);
-    }
+    while (p0.n > p1.n)
+        p0.pop_back();
 
     // consume final segments from seg1 that
     // should not influence the comparison
-    auto begin1 = seg1.begin();
-    auto it1 = seg1.end();
-    decode_view dseg1;
-    if (it1 != seg1.begin())
-    {
-        --it1;
-        dseg1 = **it1;
-    }
-    decode_view::iterator cit1 = dseg1.end();
-    std::size_t skip1 = 0;
-    bool at_slash1 = true;
-    while (n1 > n0)
-    {
-        consume_last(n1, dseg1, begin1, it1, cit1, skip1, at_slash1);
-    }
+    while (p1.n > p0.n)
+        p1.pop_back();
 
     int cmp = 0;
-    while (n0)
+    while (p0.n)
     {
-        char c0 = consume_last(
-            n0, dseg0, begin0, it0, cit0, skip0, at_slash0);
-        char c1 = consume_last(
-            n1, dseg1, begin1, it1, cit1, skip1, at_slash1);
+        char c0 = p0.pop_back();
+        char c1 = p1.pop_back();
         if (c0 < c1)
             cmp = -1;
         else if (c1 < c0)
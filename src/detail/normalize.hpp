@@ -13,6 +13,7 @@
 
 #include <boost/core/detail/string_view.hpp>
 #include "boost/url/segments_encoded_view.hpp"
+#include <cstdint>
 
 namespace boost {
 namespace urls {
@@ -67,6 +68,21 @@ private:
     std::size_t h_;
 };
 
+// finalizer of MurmurHash3, so that
+// every bit of a digest depends on
+// every bit of the input
+inline
+std::uint64_t
+mix_hash(std::uint64_t h) noexcept
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
 void
 pop_encoded_front(
     core::string_view& s,
@@ -101,15 +117,6 @@ path_starts_with(
     core::string_view lhs,
     core::string_view rhs) noexcept;
 
-// check if core::string_view lhs ends with core::string_view
-// rhs as if they are both percent-decoded. If
-// lhs ends with rhs, return number of chars
-// matched in the encoded core::string_view
-std::size_t
-path_ends_with(
-    core::string_view lhs,
-    core::string_view rhs) noexcept;
-
 // compare two core::string_views as if they are both
 // percent-decoded and lowercase
 int
@@ -150,20 +157,9 @@ remove_dot_segments(
     char const* end,
     core::string_view input) noexcept;
 
-void
-pop_last_segment(
-    core::string_view& str,
-    core::string_view& seg,
-    std::size_t& level,
-    bool remove_unmatched) noexcept;
-
-char
-path_pop_back( core::string_view& s );
-
 void
 normalized_path_digest(
-    core::string_view str,
-    bool remove_unmatched,
+    segments_encoded_view seg,
     fnv_1a& hasher) noexcept;
 
 int
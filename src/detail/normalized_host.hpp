@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_NORMALIZED_HOST_HPP
+#define BOOST_URL_DETAIL_NORMALIZED_HOST_HPP
+
+#include <boost/url/ipv6_address.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include "ipv6_text.hpp"
+#include "normalize.hpp"
+#include "../rfc/detail/charsets.hpp"
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// invoke f with each character of the
+// normalized host. Hosts are equal after
+// normalization exactly when they compare
+// equal in url_view_base::compare: IPv6
+// addresses are written in canonical form,
+// and reg-names are decoded and converted
+// to lower case, then encoded again with
+// upper case escapes where required.
+template<class F>
+void
+for_each_normalized_host(
+    core::string_view s,
+    F const& f)
+{
+    if( s.size() > 2 &&
+        s.front() == '[' &&
+        s.back() == ']')
+    {
+        ipv6_address::bytes_type bytes;
+        if( s.find('%') == core::string_view::npos &&
+            parse_ipv6_text(
+                s.data() + 1,
+                s.data() + s.size() - 1,
+                bytes))
+        {
+            char buf[normalized_host_max];
+            auto const n = normalized_host(
+                s, host_type::ipv6,
+                ipv6_address(bytes), buf);
+            for(char c : n)
+                f(c);
+            return;
+        }
+
+        // IPvFuture, or an address with a
+        // zone id, has no other form
+        int esc = 0;
+        for(char c : s)
+        {
+            if(esc != 0)
+            {
+                c = grammar::to_upper(c);
+                --esc;
+            }
+            else if(c == '%')
+            {
+                esc = 2;
+            }
+            else
+            {
+                c = grammar::to_lower(c);
+            }
+            f(c);
+        }
+        return;
+    }
+
+    static constexpr char hex[] =
+        "0123456789ABCDEF";
+    auto it = s.data();
+    auto const end = it + s.size();
+    while(it != end)
+    {
+        char c = *it++;
+        if( c == '%' &&
+            end - it >= 2 &&
+            grammar::hexdig_chars(it[0]) &&
+            grammar::hexdig_chars(it[1]))
+        {
+            c = static_cast<char>(
+                (grammar::hexdig_value(it[0]) << 4) +
+                grammar::hexdig_value(it[1]));
+            it += 2;
+        }
+        c = grammar::to_lower(c);
+        if(host_chars(c))
+        {
+            f(c);
+            continue;
+        }
+        auto const u =
+            static_cast<unsigned char>(c);
+        f('%');
+        f(hex[u >> 4]);
+        f(hex[u & 0xf]);
+    }
+}
+
+// return the size of the normalized host
+inline
+std::size_t
+normalized_host_size(core::string_view s) noexcept
+{
+    std::size_t n = 0;
+    for_each_normalized_host(s,
+        [&n](char)
+        {
+            ++n;
+        });
+    return n;
+}
+
+// return the digest of the normalized host
+inline
+std::size_t
+hash_normalized_host(core::string_view s) noexcept
+{
+    fnv_1a h(0);
+    for_each_normalized_host(s,
+        [&h](char c)
+        {
+            h.put(c);
+        });
+    return h.digest();
+}
+
+// return true if the normalized host
+// `n` is the normalization of `s`
+inline
+bool
+equal_normalized_host(
+    core::string_view n,
+    core::string_view s) noexcept
+{
+    auto it = n.data();
+    auto const end = it + n.size();
+    bool eq = true;
+    for_each_normalized_host(s,
+        [&it, end, &eq](char c)
+        {
+            eq = eq && it != end && *it++ == c;
+        });
+    return eq && it == end;
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
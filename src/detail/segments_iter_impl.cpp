@@ -43,10 +43,10 @@ segments_iter_impl(
 
 segments_iter_impl::
 segments_iter_impl(
-    url_impl const& u_,
+    detail::path_ref const& ref_,
     std::size_t pos_,
     std::size_t index_) noexcept
-    : ref(u_)
+    : ref(ref_)
     , pos(pos_)
     , index(index_)
 {
@@ -10,6 +10,13 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/grammar/ci_string.hpp>
+#include <boost/core/bit.hpp>
+#include "../detail/normalize.hpp"
+#include <cstdint>
+
+#ifdef BOOST_URL_USE_SSE2
+# include <emmintrin.h>
+#endif
 
 namespace boost {
 namespace urls {
@@ -17,6 +24,115 @@ namespace grammar {
 
 namespace detail {
 
+namespace {
+
+// Load eight characters as an integer
+// with the first character in the low
+// byte, independent of the byte order.
+inline
+std::uint64_t
+load_le(char const* p0) noexcept
+{
+    auto const p = reinterpret_cast<
+        unsigned char const*>(p0);
+    return
+        (static_cast<std::uint64_t>(p[0])      ) |
+        (static_cast<std::uint64_t>(p[1]) <<  8) |
+        (static_cast<std::uint64_t>(p[2]) << 16) |
+        (static_cast<std::uint64_t>(p[3]) << 24) |
+        (static_cast<std::uint64_t>(p[4]) << 32) |
+        (static_cast<std::uint64_t>(p[5]) << 40) |
+        (static_cast<std::uint64_t>(p[6]) << 48) |
+        (static_cast<std::uint64_t>(p[7]) << 56);
+}
+
+// Apply to_lower to each of the
+// eight characters in x at once
+inline
+std::uint64_t
+to_lower8(std::uint64_t x) noexcept
+{
+    constexpr std::uint64_t ones =
+        0x0101010101010101;
+    // the high bit of each byte is set
+    // in ge_a if the low seven bits are
+    // at least 'A', and in gt_z if they
+    // are greater than 'Z'. Bytes which
+    // have the high bit set are excluded.
+    auto const h = x & (0x7f * ones);
+    auto const ge_a = h + (0x80 - 'A') * ones;
+    auto const gt_z = h + (0x7f - 'Z') * ones;
+    auto const upper =
+        (ge_a ^ gt_z) & ~x & (0x80 * ones);
+    return x | (upper >> 2);
+}
+
+#ifdef BOOST_URL_USE_SSE2
+// Apply to_lower to each of the
+// sixteen characters in v at once
+inline
+__m128i
+to_lower16(__m128i v) noexcept
+{
+    // signed compares exclude bytes
+    // which have the high bit set
+    auto const upper = _mm_and_si128(
+        _mm_cmpgt_epi8(v,
+            _mm_set1_epi8('A' - 1)),
+        _mm_cmplt_epi8(v,
+            _mm_set1_epi8('Z' + 1)));
+    return _mm_or_si128(v,
+        _mm_and_si128(upper,
+            _mm_set1_epi8(0x20)));
+}
+#endif
+
+// Return the index of the first character
+// which differs ignoring case, or n
+std::size_t
+ci_mismatch(
+    char const* p0,
+    char const* p1,
+    std::size_t n) noexcept
+{
+    std::size_t i = 0;
+#ifdef BOOST_URL_USE_SSE2
+    for(; n - i >= 16; i += 16)
+    {
+        auto const v0 = to_lower16(
+            _mm_loadu_si128(reinterpret_cast<
+                __m128i const*>(p0 + i)));
+        auto const v1 = to_lower16(
+            _mm_loadu_si128(reinterpret_cast<
+                __m128i const*>(p1 + i)));
+        unsigned const m = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(
+                v0, v1))) ^ 0xffff;
+        if(m != 0)
+            return i + static_cast<std::size_t>(
+                core::countr_zero(m));
+    }
+#endif
+    for(; n - i >= 8; i += 8)
+    {
+        auto const x =
+            to_lower8(load_le(p0 + i)) ^
+            to_lower8(load_le(p1 + i));
+        if(x != 0)
+            return i + static_cast<std::size_t>(
+                core::countr_zero(x)) / 8;
+    }
+    for(; i < n; ++i)
+    {
+        if( to_lower(p0[i]) !=
+            to_lower(p1[i]))
+            break;
+    }
+    return i;
+}
+
+} // (anon)
+
 //------------------------------------------------
 
 // https://lemire.me/blog/2020/04/30/for-case-insensitive-string-comparisons-avoid-char-by-char-functions/
@@ -27,30 +143,10 @@ ci_is_equal(
     core::string_view s0,
     core::string_view s1) noexcept
 {
-    auto n = s0.size();
-    auto p1 = s0.data();
-    auto p2 = s1.data();
-    char a, b;
-    // fast loop
-    while(n--)
-    {
-        a = *p1++;
-        b = *p2++;
-        if(a != b)
-            goto slow;
-    }
-    return true;
-slow:
-    do
-    {
-        if( to_lower(a) !=
-            to_lower(b))
-            return false;
-        a = *p1++;
-        b = *p2++;
-    }
-    while(n--);
-    return true;
+    BOOST_ASSERT(s0.size() == s1.size());
+    return ci_mismatch(
+        s0.data(), s1.data(),
+        s0.size()) == s0.size();
 }
 
 //------------------------------------------------
@@ -60,17 +156,17 @@ ci_is_less(
     core::string_view s0,
     core::string_view s1) noexcept
 {
-    auto p1 = s0.data();
-    auto p2 = s1.data();
-    for(auto n = s0.size();n--;)
+    BOOST_ASSERT(s0.size() == s1.size());
+    auto const i = ci_mismatch(
+        s0.data(), s1.data(), s0.size());
+    if(i == s0.size())
     {
-        auto c1 = to_lower(*p1++);
-        auto c2 = to_lower(*p2++);
-        if(c1 != c2)
-            return c1 < c2;
+        // equal
+        return false;
     }
-    // equal
-    return false;
+    return
+        to_lower(s0[i]) <
+        to_lower(s1[i]);
 }
 
 } // detail
@@ -99,21 +195,14 @@ ci_compare(
             bias = 0;
         n = s1.size();
     }
-    auto it0 = s0.data();
-    auto it1 = s1.data();
-    while(n--)
-    {
-        auto c0 =
-            to_lower(*it0++);
-        auto c1 =
-            to_lower(*it1++);
-        if(c0 == c1)
-            continue;
-        if(c0 < c1)
-            return -1;
-        return 1;
-    }
-    return bias;
+    auto const i = detail::ci_mismatch(
+        s0.data(), s1.data(), n);
+    if(i == n)
+        return bias;
+    if( to_lower(s0[i]) <
+        to_lower(s1[i]))
+        return -1;
+    return 1;
 }
 
 //------------------------------------------------
@@ -126,24 +215,45 @@ ci_digest(
     static_assert(
         sizeof(std::size_t) == 4 ||
         sizeof(std::size_t) == 8, "");
-    constexpr std::size_t prime = (
-        sizeof(std::size_t) == 8) ?
-            0x100000001B3ULL :
-            0x01000193UL;
-    constexpr std::size_t hash0 = (
-        sizeof(std::size_t) == 8) ?
-            0xcbf29ce484222325ULL :
-            0x811C9DC5UL;
-    auto hash = hash0;
+
+    // Eight characters are folded to lower
+    // case and mixed in at a time. The
+    // characters are loaded in the same
+    // order on every platform, so digests
+    // do not depend on the byte order or
+    // on the instruction set.
+    constexpr std::uint64_t k =
+        0x9E3779B97F4A7C15ULL;
+    std::uint64_t h =
+        0xcbf29ce484222325ULL;
     auto p = s.data();
     auto n = s.size();
-    for(;n--;++p)
+    for(; n >= 8; n -= 8, p += 8)
+    {
+        h ^= detail::to_lower8(
+            detail::load_le(p));
+        h *= k;
+        h ^= h >> 29;
+    }
+    if(n > 0)
     {
-        // VFALCO NOTE Consider using a lossy
-        // to_lower which works 4 or 8 chars at a time.
-        hash = (to_lower(*p) ^ hash) * prime;
+        // zero padded, the size is
+        // mixed in below
+        std::uint64_t w = 0;
+        for(std::size_t i = 0; i < n; ++i)
+            w |= static_cast<std::uint64_t>(
+                static_cast<unsigned char>(
+                    p[i])) << (8 * i);
+        h ^= detail::to_lower8(w);
+        h *= k;
+        h ^= h >> 29;
     }
-    return hash;
+
+    // finalize
+    h ^= static_cast<
+        std::uint64_t>(s.size());
+    return static_cast<std::size_t>(
+        urls::detail::mix_hash(h));
 }
 
 } // grammar
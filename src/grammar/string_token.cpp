@@ -0,0 +1,130 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/grammar/string_token.hpp>
+#include <new>
+
+namespace boost {
+namespace urls {
+namespace string_token {
+
+struct arena::block
+{
+    block* next;
+    std::size_t size;
+
+    char*
+    data() noexcept
+    {
+        return reinterpret_cast<
+            char*>(this + 1);
+    }
+
+    static
+    void
+    destroy(block* b) noexcept
+    {
+        while(b)
+        {
+            block* next = b->next;
+            ::operator delete(b);
+            b = next;
+        }
+    }
+};
+
+arena::
+~arena()
+{
+    block::destroy(head_);
+    block::destroy(free_);
+}
+
+arena::
+arena() noexcept = default;
+
+arena::
+arena(
+    char* buf,
+    std::size_t size) noexcept
+    : p_(buf)
+    , end_(buf + size)
+    , buf_(buf)
+    , buf_size_(size)
+{
+}
+
+char*
+arena::
+allocate_slow(std::size_t n)
+{
+    block* b;
+    if( free_ &&
+        free_->size >= n)
+    {
+        b = free_;
+        free_ = nullptr;
+    }
+    else
+    {
+        std::size_t size = grow_;
+        if(size < 1024)
+            size = 1024;
+        if(size < n)
+            size = n;
+        if(size > std::size_t(-1) - sizeof(block))
+            detail::throw_length_error();
+        b = static_cast<block*>(::operator new(
+            sizeof(block) + size));
+        b->size = size;
+    }
+    b->next = head_;
+    head_ = b;
+    grow_ = 2 * b->size;
+    p_ = b->data() + n;
+    end_ = b->data() + b->size;
+    used_ += n;
+    return b->data();
+}
+
+void
+arena::
+release() noexcept
+{
+    if(head_)
+    {
+        if(! head_->next)
+        {
+            // keep a single block
+            block::destroy(free_);
+            free_ = head_;
+            free_->next = nullptr;
+        }
+        else
+        {
+            // the next block holds them all
+            std::size_t total = 0;
+            for(block* b = head_; b; b = b->next)
+                total += b->size;
+            block::destroy(head_);
+            grow_ = total;
+        }
+        head_ = nullptr;
+    }
+    p_ = buf_;
+    end_ = buf_ + buf_size_;
+    used_ = 0;
+}
+
+} // string_token
+} // urls
+} // boost
+
@@ -0,0 +1,150 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/grammar/telemetry.hpp>
+#include <boost/url/grammar/detail/telemetry.hpp>
+#include <boost/core/demangle.hpp>
+#include <algorithm>
+#include <atomic>
+
+namespace boost {
+namespace urls {
+namespace grammar {
+
+constexpr std::size_t rule_telemetry::error_buckets;
+
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+
+namespace detail {
+
+static_assert(
+    telemetry_errors ==
+    rule_telemetry::error_buckets,
+    "telemetry_errors");
+
+namespace {
+
+// the list of counters, to which
+// elements are only ever added
+std::atomic<rule_counters*> head_{nullptr};
+
+} // (anon)
+
+void
+add_rule_counters(
+    rule_counters& c) noexcept
+{
+    auto* p = head_.load(
+        std::memory_order_relaxed);
+    do
+    {
+        c.next = p;
+    }
+    while(! head_.compare_exchange_weak(
+        p, &c,
+        std::memory_order_release,
+        std::memory_order_relaxed));
+}
+
+} // detail
+
+std::vector<rule_telemetry>
+telemetry_snapshot()
+{
+    std::vector<rule_telemetry> v;
+    for(auto* p = detail::head_.load(
+            std::memory_order_acquire);
+        p; p = p->next)
+    {
+        rule_telemetry t;
+        t.name = core::demangle(p->name);
+        t.calls = p->calls.load(
+            std::memory_order_relaxed);
+        t.failures = p->failures.load(
+            std::memory_order_relaxed);
+        t.bytes = p->bytes.load(
+            std::memory_order_relaxed);
+        for(std::size_t i = 0;
+                i < rule_telemetry::error_buckets; ++i)
+            t.errors[i] = p->errors[i].load(
+                std::memory_order_relaxed);
+        v.push_back(std::move(t));
+    }
+    std::sort(v.begin(), v.end(),
+        [](rule_telemetry const& a,
+            rule_telemetry const& b)
+        {
+            return a.name < b.name;
+        });
+
+    // a rule used in several modules
+    // may have several counters
+    std::size_t n = 0;
+    for(std::size_t i = 0; i < v.size(); ++i)
+    {
+        if( n > 0 &&
+            v[n - 1].name == v[i].name)
+        {
+            auto& t = v[n - 1];
+            t.calls += v[i].calls;
+            t.failures += v[i].failures;
+            t.bytes += v[i].bytes;
+            for(std::size_t j = 0;
+                    j < rule_telemetry::error_buckets; ++j)
+                t.errors[j] += v[i].errors[j];
+            continue;
+        }
+        if(n != i)
+            v[n] = std::move(v[i]);
+        ++n;
+    }
+    v.resize(n);
+    return v;
+}
+
+void
+telemetry_reset() noexcept
+{
+    for(auto* p = detail::head_.load(
+            std::memory_order_acquire);
+        p; p = p->next)
+    {
+        p->calls.store(0,
+            std::memory_order_relaxed);
+        p->failures.store(0,
+            std::memory_order_relaxed);
+        p->bytes.store(0,
+            std::memory_order_relaxed);
+        for(auto& e : p->errors)
+            e.store(0,
+                std::memory_order_relaxed);
+    }
+}
+
+#else
+
+std::vector<rule_telemetry>
+telemetry_snapshot()
+{
+    return {};
+}
+
+void
+telemetry_reset() noexcept
+{
+}
+
+#endif
+
+} // grammar
+} // urls
+} // boost
+
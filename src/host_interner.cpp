@@ -0,0 +1,336 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/host_interner.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/core/bit.hpp>
+#include "detail/arena.hpp"
+#include "detail/mutex.hpp"
+#include "detail/normalize.hpp"
+#include "detail/normalized_host.hpp"
+#include <atomic>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// size of the blocks holding the
+// characters of the hosts in a shard
+constexpr std::size_t arena_block = 16 * 1024;
+
+// the first segment holds this many entries
+constexpr std::size_t segment_base = 1024;
+
+// the digest of the normalized host, mixed
+// so that the bits selecting the shard and
+// the slot are well distributed
+std::uint64_t
+hash_host(core::string_view s) noexcept
+{
+    return detail::mix_hash(
+        detail::hash_normalized_host(s));
+}
+
+// return the segment holding the id,
+// and the index of the id within it
+std::size_t
+segment_of(
+    std::uint32_t id,
+    std::size_t& i) noexcept
+{
+    std::size_t const x =
+        (static_cast<std::size_t>(id) /
+            segment_base) + 1;
+    std::size_t const k = 63 -
+        static_cast<std::size_t>(
+            core::countl_zero(
+                static_cast<std::uint64_t>(x)));
+    i = id - segment_base * (
+        (std::size_t(1) << k) - 1);
+    return k;
+}
+
+} // (anon)
+
+//------------------------------------------------
+
+struct host_interner::shard
+{
+    // a slot is published by storing the id
+    // plus one with release semantics, after
+    // the hash and the host were written, and
+    // is never changed afterwards.
+    struct slot
+    {
+        std::uint64_t hash;
+        std::atomic<std::uint32_t> id;
+    };
+
+    // tables are replaced when they grow, and
+    // the previous ones are kept until the
+    // interner is destroyed, since readers
+    // may still be probing them.
+    struct table
+    {
+        std::size_t cap;
+        std::unique_ptr<slot[]> slots;
+
+        explicit
+        table(std::size_t n)
+            : cap(n)
+            , slots(new slot[n])
+        {
+            for(std::size_t i = 0; i < n; ++i)
+                slots[i].id.store(0,
+                    std::memory_order_relaxed);
+        }
+
+        // insert a slot which is not present
+        void
+        insert(
+            std::uint64_t hash,
+            std::uint32_t id) noexcept
+        {
+            std::size_t const mask = cap - 1;
+            std::size_t i = static_cast<
+                std::size_t>(hash) & mask;
+            while(slots[i].id.load(
+                    std::memory_order_relaxed) != 0)
+                i = (i + 1) & mask;
+            slots[i].hash = hash;
+            slots[i].id.store(id + 1,
+                std::memory_order_release);
+        }
+    };
+
+    detail::mutex m;
+    std::atomic<table*> tab{nullptr};
+    std::vector<std::unique_ptr<table>> tables;
+    std::size_t n = 0;
+
+    detail::arena<arena_block> chars;
+
+    // return the id plus one of the host
+    // with the given hash, or zero. No lock
+    // is needed.
+    std::uint32_t
+    probe(
+        std::uint64_t h,
+        core::string_view s,
+        host_interner const& hi) const noexcept
+    {
+        table const* t = tab.load(
+            std::memory_order_acquire);
+        if(! t)
+            return 0;
+        std::size_t const mask = t->cap - 1;
+        std::size_t i = static_cast<
+            std::size_t>(h) & mask;
+        for(;;)
+        {
+            auto const& sl = t->slots[i];
+            auto const id = sl.id.load(
+                std::memory_order_acquire);
+            if(id == 0)
+                return 0;
+            if( sl.hash == h &&
+                detail::equal_normalized_host(
+                    hi.host(id - 1), s))
+                return id;
+            i = (i + 1) & mask;
+        }
+    }
+
+    // make room for one more slot
+    void
+    reserve()
+    {
+        table const* t = tab.load(
+            std::memory_order_relaxed);
+        std::size_t const cap =
+            t ? t->cap : 0;
+        if((n + 1) * 4 <= cap * 3)
+            return;
+        std::unique_ptr<table> t1(
+            new table(cap ? cap * 2 : 16));
+        for(std::size_t j = 0; j < cap; ++j)
+        {
+            auto const& sl = t->slots[j];
+            auto const id = sl.id.load(
+                std::memory_order_relaxed);
+            if(id != 0)
+                t1->insert(sl.hash, id - 1);
+        }
+        tables.reserve(tables.size() + 1);
+        tab.store(t1.get(),
+            std::memory_order_release);
+        tables.emplace_back(std::move(t1));
+    }
+};
+
+struct host_interner::ids
+{
+    detail::mutex m;
+};
+
+//------------------------------------------------
+
+constexpr std::size_t host_interner::segments;
+
+host_interner::
+~host_interner()
+{
+    for(auto& p : segs_)
+        delete[] p.load(
+            std::memory_order_relaxed);
+}
+
+host_interner::
+host_interner(
+    std::size_t shards)
+{
+    if(shards == 0)
+        detail::throw_invalid_argument();
+    for(auto& p : segs_)
+        p.store(nullptr,
+            std::memory_order_relaxed);
+    std::size_t n = 1;
+    while(n < shards)
+        n *= 2;
+    shards_.reset(new shard[n]);
+    ids_.reset(new ids);
+    shard_mask_ = n - 1;
+}
+
+auto
+host_interner::
+segment(std::uint32_t id) ->
+    entry*
+{
+    std::size_t i;
+    auto const k = segment_of(id, i);
+    entry* p = segs_[k].load(
+        std::memory_order_relaxed);
+    if(! p)
+    {
+        p = new entry[segment_base << k];
+        segs_[k].store(p,
+            std::memory_order_release);
+    }
+    return p + i;
+}
+
+auto
+host_interner::
+find_entry(
+    std::uint32_t id) const noexcept ->
+        entry const*
+{
+    std::size_t i;
+    auto const k = segment_of(id, i);
+    return segs_[k].load(
+        std::memory_order_acquire) + i;
+}
+
+std::uint32_t
+host_interner::
+intern(core::string_view s)
+{
+    auto const h = hash_host(s);
+    shard& sh = shards_[static_cast<
+        std::size_t>(h >> 40) & shard_mask_];
+    detail::lock lock(sh.m);
+    auto const found = sh.probe(h, s, *this);
+    if(found != 0)
+        return found - 1;
+
+    // allocate everything before the
+    // new host becomes visible
+    sh.reserve();
+    auto const size = detail::normalized_host_size(s);
+    char* const p = sh.chars.allocate(size);
+    std::uint32_t id;
+    {
+        detail::lock ids_lock(ids_->m);
+        id = size_.load(
+            std::memory_order_relaxed);
+        if(id == 0xffffffff)
+            detail::throw_length_error();
+        entry* e = segment(id);
+        auto it = p;
+        detail::for_each_normalized_host(s,
+            [&it](char c)
+            {
+                *it++ = c;
+            });
+        e->data = p;
+        e->size = size;
+        size_.store(id + 1,
+            std::memory_order_release);
+    }
+    sh.tab.load(std::memory_order_relaxed
+        )->insert(h, id);
+    ++sh.n;
+    return id;
+}
+
+boost::optional<std::uint32_t>
+host_interner::
+find(core::string_view s) const noexcept
+{
+    auto const h = hash_host(s);
+    shard const& sh = shards_[static_cast<
+        std::size_t>(h >> 40) & shard_mask_];
+    auto const id = sh.probe(h, s, *this);
+    if(id == 0)
+        return boost::none;
+    return id - 1;
+}
+
+core::string_view
+host_interner::
+host(std::uint32_t id) const noexcept
+{
+    auto const e = find_entry(id);
+    return core::string_view(
+        e->data, e->size);
+}
+
+std::size_t
+host_interner::
+memory_usage() const
+{
+    std::size_t n =
+        (shard_mask_ + 1) * sizeof(shard);
+    for(std::size_t i = 0;
+            i <= shard_mask_; ++i)
+    {
+        shard& sh = shards_[i];
+        detail::lock lock(sh.m);
+        for(auto const& t : sh.tables)
+            n += sizeof(shard::table) +
+                t->cap * sizeof(shard::slot);
+        n += sh.chars.bytes();
+    }
+    for(std::size_t k = 0; k < segments; ++k)
+        if(segs_[k].load(
+                std::memory_order_acquire))
+            n += (segment_base << k) *
+                sizeof(entry);
+    return n;
+}
+
+} // urls
+} // boost
+
@@ -13,11 +13,244 @@
 #include <boost/url/detail/except.hpp>
 #include <boost/url/grammar/parse.hpp>
 #include <boost/url/rfc/ipv4_address_rule.hpp>
+#include <boost/assert.hpp>
+#include <cstdint>
 #include <cstring>
 
 namespace boost {
 namespace urls {
 
+namespace {
+
+// the printed form of each octet, as
+// the length followed by the digits
+constexpr char octet_table[256][4] = {
+    {1,'0','0','0'}, {1,'1','0','0'}, {1,'2','0','0'}, {1,'3','0','0'},
+    {1,'4','0','0'}, {1,'5','0','0'}, {1,'6','0','0'}, {1,'7','0','0'},
+    {1,'8','0','0'}, {1,'9','0','0'}, {2,'1','0','0'}, {2,'1','1','0'},
+    {2,'1','2','0'}, {2,'1','3','0'}, {2,'1','4','0'}, {2,'1','5','0'},
+    {2,'1','6','0'}, {2,'1','7','0'}, {2,'1','8','0'}, {2,'1','9','0'},
+    {2,'2','0','0'}, {2,'2','1','0'}, {2,'2','2','0'}, {2,'2','3','0'},
+    {2,'2','4','0'}, {2,'2','5','0'}, {2,'2','6','0'}, {2,'2','7','0'},
+    {2,'2','8','0'}, {2,'2','9','0'}, {2,'3','0','0'}, {2,'3','1','0'},
+    {2,'3','2','0'}, {2,'3','3','0'}, {2,'3','4','0'}, {2,'3','5','0'},
+    {2,'3','6','0'}, {2,'3','7','0'}, {2,'3','8','0'}, {2,'3','9','0'},
+    {2,'4','0','0'}, {2,'4','1','0'}, {2,'4','2','0'}, {2,'4','3','0'},
+    {2,'4','4','0'}, {2,'4','5','0'}, {2,'4','6','0'}, {2,'4','7','0'},
+    {2,'4','8','0'}, {2,'4','9','0'}, {2,'5','0','0'}, {2,'5','1','0'},
+    {2,'5','2','0'}, {2,'5','3','0'}, {2,'5','4','0'}, {2,'5','5','0'},
+    {2,'5','6','0'}, {2,'5','7','0'}, {2,'5','8','0'}, {2,'5','9','0'},
+    {2,'6','0','0'}, {2,'6','1','0'}, {2,'6','2','0'}, {2,'6','3','0'},
+    {2,'6','4','0'}, {2,'6','5','0'}, {2,'6','6','0'}, {2,'6','7','0'},
+    {2,'6','8','0'}, {2,'6','9','0'}, {2,'7','0','0'}, {2,'7','1','0'},
+    {2,'7','2','0'}, {2,'7','3','0'}, {2,'7','4','0'}, {2,'7','5','0'},
+    {2,'7','6','0'}, {2,'7','7','0'}, {2,'7','8','0'}, {2,'7','9','0'},
+    {2,'8','0','0'}, {2,'8','1','0'}, {2,'8','2','0'}, {2,'8','3','0'},
+    {2,'8','4','0'}, {2,'8','5','0'}, {2,'8','6','0'}, {2,'8','7','0'},
+    {2,'8','8','0'}, {2,'8','9','0'}, {2,'9','0','0'}, {2,'9','1','0'},
+    {2,'9','2','0'}, {2,'9','3','0'}, {2,'9','4','0'}, {2,'9','5','0'},
+    {2,'9','6','0'}, {2,'9','7','0'}, {2,'9','8','0'}, {2,'9','9','0'},
+    {3,'1','0','0'}, {3,'1','0','1'}, {3,'1','0','2'}, {3,'1','0','3'},
+    {3,'1','0','4'}, {3,'1','0','5'}, {3,'1','0','6'}, {3,'1','0','7'},
+    {3,'1','0','8'}, {3,'1','0','9'}, {3,'1','1','0'}, {3,'1','1','1'},
+    {3,'1','1','2'}, {3,'1','1','3'}, {3,'1','1','4'}, {3,'1','1','5'},
+    {3,'1','1','6'}, {3,'1','1','7'}, {3,'1','1','8'}, {3,'1','1','9'},
+    {3,'1','2','0'}, {3,'1','2','1'}, {3,'1','2','2'}, {3,'1','2','3'},
+    {3,'1','2','4'}, {3,'1','2','5'}, {3,'1','2','6'}, {3,'1','2','7'},
+    {3,'1','2','8'}, {3,'1','2','9'}, {3,'1','3','0'}, {3,'1','3','1'},
+    {3,'1','3','2'}, {3,'1','3','3'}, {3,'1','3','4'}, {3,'1','3','5'},
+    {3,'1','3','6'}, {3,'1','3','7'}, {3,'1','3','8'}, {3,'1','3','9'},
+    {3,'1','4','0'}, {3,'1','4','1'}, {3,'1','4','2'}, {3,'1','4','3'},
+    {3,'1','4','4'}, {3,'1','4','5'}, {3,'1','4','6'}, {3,'1','4','7'},
+    {3,'1','4','8'}, {3,'1','4','9'}, {3,'1','5','0'}, {3,'1','5','1'},
+    {3,'1','5','2'}, {3,'1','5','3'}, {3,'1','5','4'}, {3,'1','5','5'},
+    {3,'1','5','6'}, {3,'1','5','7'}, {3,'1','5','8'}, {3,'1','5','9'},
+    {3,'1','6','0'}, {3,'1','6','1'}, {3,'1','6','2'}, {3,'1','6','3'},
+    {3,'1','6','4'}, {3,'1','6','5'}, {3,'1','6','6'}, {3,'1','6','7'},
+    {3,'1','6','8'}, {3,'1','6','9'}, {3,'1','7','0'}, {3,'1','7','1'},
+    {3,'1','7','2'}, {3,'1','7','3'}, {3,'1','7','4'}, {3,'1','7','5'},
+    {3,'1','7','6'}, {3,'1','7','7'}, {3,'1','7','8'}, {3,'1','7','9'},
+    {3,'1','8','0'}, {3,'1','8','1'}, {3,'1','8','2'}, {3,'1','8','3'},
+    {3,'1','8','4'}, {3,'1','8','5'}, {3,'1','8','6'}, {3,'1','8','7'},
+    {3,'1','8','8'}, {3,'1','8','9'}, {3,'1','9','0'}, {3,'1','9','1'},
+    {3,'1','9','2'}, {3,'1','9','3'}, {3,'1','9','4'}, {3,'1','9','5'},
+    {3,'1','9','6'}, {3,'1','9','7'}, {3,'1','9','8'}, {3,'1','9','9'},
+    {3,'2','0','0'}, {3,'2','0','1'}, {3,'2','0','2'}, {3,'2','0','3'},
+    {3,'2','0','4'}, {3,'2','0','5'}, {3,'2','0','6'}, {3,'2','0','7'},
+    {3,'2','0','8'}, {3,'2','0','9'}, {3,'2','1','0'}, {3,'2','1','1'},
+    {3,'2','1','2'}, {3,'2','1','3'}, {3,'2','1','4'}, {3,'2','1','5'},
+    {3,'2','1','6'}, {3,'2','1','7'}, {3,'2','1','8'}, {3,'2','1','9'},
+    {3,'2','2','0'}, {3,'2','2','1'}, {3,'2','2','2'}, {3,'2','2','3'},
+    {3,'2','2','4'}, {3,'2','2','5'}, {3,'2','2','6'}, {3,'2','2','7'},
+    {3,'2','2','8'}, {3,'2','2','9'}, {3,'2','3','0'}, {3,'2','3','1'},
+    {3,'2','3','2'}, {3,'2','3','3'}, {3,'2','3','4'}, {3,'2','3','5'},
+    {3,'2','3','6'}, {3,'2','3','7'}, {3,'2','3','8'}, {3,'2','3','9'},
+    {3,'2','4','0'}, {3,'2','4','1'}, {3,'2','4','2'}, {3,'2','4','3'},
+    {3,'2','4','4'}, {3,'2','4','5'}, {3,'2','4','6'}, {3,'2','4','7'},
+    {3,'2','4','8'}, {3,'2','4','9'}, {3,'2','5','0'}, {3,'2','5','1'},
+    {3,'2','5','2'}, {3,'2','5','3'}, {3,'2','5','4'}, {3,'2','5','5'},
+};
+
+// Load eight characters as an integer
+// with the first character in the low
+// byte, independent of the byte order.
+inline
+std::uint64_t
+load_le(unsigned char const* p) noexcept
+{
+    return
+        (static_cast<std::uint64_t>(p[0])      ) |
+        (static_cast<std::uint64_t>(p[1]) <<  8) |
+        (static_cast<std::uint64_t>(p[2]) << 16) |
+        (static_cast<std::uint64_t>(p[3]) << 24) |
+        (static_cast<std::uint64_t>(p[4]) << 32) |
+        (static_cast<std::uint64_t>(p[5]) << 40) |
+        (static_cast<std::uint64_t>(p[6]) << 48) |
+        (static_cast<std::uint64_t>(p[7]) << 56);
+}
+
+// Return a mask with one bit for each
+// byte in x having its high bit set
+inline
+unsigned
+high_bits(std::uint64_t x) noexcept
+{
+    return static_cast<unsigned>((
+        ((x >> 7) & 0x0101010101010101) *
+            0x0102040810204080) >> 56);
+}
+
+// Return a mask with one bit for each
+// byte in x which is a DIGIT
+inline
+unsigned
+digit_mask(std::uint64_t x) noexcept
+{
+    // bytes less than 10 after subtracting
+    // '0' are digits; the additions never
+    // carry into the next byte.
+    std::uint64_t const t =
+        x ^ 0x3030303030303030;
+    std::uint64_t const ge10 =
+        ((t & 0x7f7f7f7f7f7f7f7f) +
+            0x7676767676767676) | t;
+    return ~high_bits(ge10) & 0xff;
+}
+
+// Return a mask with one bit for each
+// byte in x which is '.'
+inline
+unsigned
+dot_mask(std::uint64_t x) noexcept
+{
+    std::uint64_t const t =
+        x ^ 0x2e2e2e2e2e2e2e2e;
+    std::uint64_t const nz =
+        ((t & 0x7f7f7f7f7f7f7f7f) +
+            0x7f7f7f7f7f7f7f7f) | t;
+    return ~high_bits(nz) & 0xff;
+}
+
+inline
+unsigned
+ctz16(unsigned m) noexcept
+{
+    BOOST_ASSERT(m != 0);
+    unsigned n = 0;
+    while(! (m & 1))
+    {
+        m >>= 1;
+        ++n;
+    }
+    return n;
+}
+
+// Convert one dec-octet of length n
+// starting at p, returning a value
+// above 255 on failure.
+inline
+unsigned
+octet(
+    unsigned char const* p,
+    unsigned n) noexcept
+{
+    unsigned const d0 = p[0] - '0';
+    switch(n)
+    {
+    case 1:
+        return d0;
+    case 2:
+        if(d0 == 0)
+            return 256; // leading '0'
+        return 10 * d0 + (p[1] - '0');
+    case 3:
+        if(d0 == 0)
+            return 256; // leading '0'
+        return 100 * d0 +
+            10 * (p[1] - '0') +
+                (p[2] - '0');
+    default:
+        return 256;
+    }
+}
+
+// Parse an entire string as a dotted
+// quad, classifying all characters at
+// once. Returns false on any error.
+bool
+parse_dotted_quad(
+    core::string_view s,
+    std::uint32_t& result) noexcept
+{
+    if( s.size() < 7 ||
+        s.size() > ipv4_address::max_str_len)
+        return false;
+    unsigned char buf[16] = {};
+    std::memcpy(buf, s.data(), s.size());
+    std::uint64_t const lo = load_le(buf);
+    std::uint64_t const hi = load_le(buf + 8);
+    unsigned const dots =
+        dot_mask(lo) | (dot_mask(hi) << 8);
+    unsigned const digits =
+        digit_mask(lo) | (digit_mask(hi) << 8);
+    unsigned const all =
+        (1u << s.size()) - 1;
+    if( ((dots | digits) & all) != all ||
+        (dots & all) == 0)
+        return false;
+    // exactly three dots, with the
+    // octet lengths between them
+    unsigned m = dots & all;
+    unsigned const d0 = ctz16(m);
+    m &= m - 1;
+    if(m == 0)
+        return false;
+    unsigned const d1 = ctz16(m);
+    m &= m - 1;
+    if(m == 0)
+        return false;
+    unsigned const d2 = ctz16(m);
+    m &= m - 1;
+    if(m != 0)
+        return false;
+    unsigned const n = static_cast<
+        unsigned>(s.size());
+    unsigned const v0 = octet(buf, d0);
+    unsigned const v1 = octet(buf + d0 + 1, d1 - d0 - 1);
+    unsigned const v2 = octet(buf + d1 + 1, d2 - d1 - 1);
+    unsigned const v3 = octet(buf + d2 + 1, n - d2 - 1);
+    if((v0 | v1 | v2 | v3) > 255)
+        return false;
+    result =
+        (static_cast<std::uint32_t>(v0) << 24) |
+        (static_cast<std::uint32_t>(v1) << 16) |
+        (static_cast<std::uint32_t>(v2) <<  8) |
+         static_cast<std::uint32_t>(v3);
+    return true;
+}
+
+} // (anon)
+
 ipv4_address::
 ipv4_address(
     uint_type addr) noexcept
@@ -106,36 +339,27 @@ ipv4_address::
 print_impl(
     char* dest) const noexcept
 {
+    // Each octet is copied from the table
+    // as three characters and the output
+    // is advanced by the printed length,
+    // so at most max_str_len characters
+    // are written.
     auto const start = dest;
+    auto const v = to_uint();
     auto const write =
-        []( char*& dest,
-            unsigned char v)
+        [](char* dest, unsigned char b)
         {
-            if(v >= 100)
-            {
-                *dest++ = '0' +
-                    v / 100;
-                v %= 100;
-                *dest++ = '0' +
-                    v / 10;
-                v %= 10;
-            }
-            else if(v >= 10)
-            {
-                *dest++ = '0' +
-                    v / 10;
-                v %= 10;
-            }
-            *dest++ = '0' + v;
+            auto const& e = octet_table[b];
+            std::memcpy(dest, e + 1, 3);
+            return dest + e[0];
         };
-    auto const v = to_uint();
-    write(dest, (v >> 24) & 0xff);
+    dest = write(dest, (v >> 24) & 0xff);
     *dest++ = '.';
-    write(dest, (v >> 16) & 0xff);
+    dest = write(dest, (v >> 16) & 0xff);
     *dest++ = '.';
-    write(dest, (v >>  8) & 0xff);
+    dest = write(dest, (v >>  8) & 0xff);
     *dest++ = '.';
-    write(dest, (v      ) & 0xff);
+    dest = write(dest, (v      ) & 0xff);
     return dest - start;
 }
 
@@ -157,6 +381,10 @@ parse_ipv4_address(
     core::string_view s) noexcept ->
         system::result<ipv4_address>
 {
+    std::uint32_t v;
+    if(parse_dotted_quad(s, v))
+        return ipv4_address(v);
+    // slow path for the error
     return grammar::parse(
         s, ipv4_address_rule);
 }
@@ -14,6 +14,7 @@
 #include <boost/url/rfc/ipv6_address_rule.hpp>
 #include <boost/url/detail/except.hpp>
 #include <boost/url/grammar/parse.hpp>
+#include "detail/ipv6_text.hpp"
 #include <cstring>
 
 namespace boost {
@@ -101,124 +102,67 @@ ipv6_address::
 print_impl(
     char* dest) const noexcept
 {
-    auto const count_zeroes =
-    []( unsigned char const* first,
-        unsigned char const* const last)
+    char const* const dig =
+        "0123456789abcdef";
+    auto const v4 = is_v4_mapped();
+    int const nw = v4 ? 6 : 8;
+
+    // load the words and find the first
+    // longest run of two or more zero
+    // words in the same pass (rfc5952)
+    unsigned w[8];
+    int best = -1;
+    int best_len = 1;
+    int run = 0;
+    for(int i = 0; i < nw; ++i)
     {
-        std::size_t n = 0;
-        while(first != last)
+        w[i] =
+            (addr_[2 * i] * 256U) +
+            addr_[2 * i + 1];
+        if(w[i] != 0)
         {
-            if( first[0] != 0 ||
-                first[1] != 0)
-                break;
-            n += 2;
-            first += 2;
-        }
-        return n;
-    };
-    auto const print_hex =
-    []( char* dest,
-        unsigned short v)
-    {
-        char const* const dig =
-            "0123456789abcdef";
-        if(v >= 0x1000)
-        {
-            *dest++ = dig[v>>12];
-            v &= 0x0fff;
-            *dest++ = dig[v>>8];
-            v &= 0x0ff;
-            *dest++ = dig[v>>4];
-            v &= 0x0f;
-            *dest++ = dig[v];
-        }
-        else if(v >= 0x100)
-        {
-            *dest++ = dig[v>>8];
-            v &= 0x0ff;
-            *dest++ = dig[v>>4];
-            v &= 0x0f;
-            *dest++ = dig[v];
-        }
-        else if(v >= 0x10)
-        {
-            *dest++ = dig[v>>4];
-            v &= 0x0f;
-            *dest++ = dig[v];
-        }
-        else
-        {
-            *dest++ = dig[v];
-        }
-        return dest;
-    };
-    auto const dest0 = dest;
-    // find longest run of zeroes
-    std::size_t best_len = 0;
-    int best_pos = -1;
-    auto it = addr_.data();
-    auto const v4 =
-        is_v4_mapped();
-    auto const end = v4 ?
-        (it + addr_.size() - 4)
-        : it + addr_.size();
-    while(it != end)
-    {
-        auto n = count_zeroes(
-            it, end);
-        if(n == 0)
-        {
-            it += 2;
+            run = 0;
             continue;
         }
-        if(n > best_len)
+        if(++run > best_len)
         {
-            best_pos = static_cast<
-                int>(it - addr_.data());
-            best_len = n;
+            best = i + 1 - run;
+            best_len = run;
         }
-        it += n;
-    }
-    it = addr_.data();
-    if(best_pos != 0)
-    {
-        unsigned short v =
-            (it[0] * 256U) + it[1];
-        dest = print_hex(dest, v);
-        it += 2;
     }
-    else
-    {
-        *dest++ = ':';
-        it += best_len;
-        if(it == end)
-            *dest++ = ':';
-    }
-    while(it != end)
+
+    auto const dest0 = dest;
+    int const after = best + best_len;
+    for(int i = 0; i < nw; ++i)
     {
-        *dest++ = ':';
-        if(it - addr_.data() ==
-            best_pos)
+        if(i == best)
         {
-            it += best_len;
-            if(it == end)
-                *dest++ = ':';
+            *dest++ = ':';
+            *dest++ = ':';
+            i = after - 1;
             continue;
         }
-        unsigned short v =
-            (it[0] * 256U) + it[1];
-        dest = print_hex(dest, v);
-        it += 2;
+        if(i != 0 && i != after)
+            *dest++ = ':';
+        auto const v = w[i];
+        if(v >= 0x1000)
+            *dest++ = dig[v >> 12];
+        if(v >= 0x100)
+            *dest++ = dig[(v >> 8) & 0xf];
+        if(v >= 0x10)
+            *dest++ = dig[(v >> 4) & 0xf];
+        *dest++ = dig[v & 0xf];
     }
     if(v4)
     {
         ipv4_address::bytes_type bytes;
-        bytes[0] = it[0];
-        bytes[1] = it[1];
-        bytes[2] = it[2];
-        bytes[3] = it[3];
+        bytes[0] = addr_[12];
+        bytes[1] = addr_[13];
+        bytes[2] = addr_[14];
+        bytes[3] = addr_[15];
         ipv4_address a(bytes);
-        *dest++ = ':';
+        if(after != nw)
+            *dest++ = ':';
         dest += a.print_impl(dest);
     }
     return dest - dest0;
@@ -242,10 +186,68 @@ parse_ipv6_address(
     core::string_view s) noexcept ->
         system::result<ipv6_address>
 {
+    ipv6_address::bytes_type bytes;
+    if(detail::parse_ipv6_text(
+        s.data(), s.data() + s.size(),
+            bytes))
+        return ipv6_address(bytes);
+    // the grammar provides the error
     return grammar::parse(
         s, ipv6_address_rule);
 }
 
+std::size_t
+parse_ipv6_addresses(
+    core::string_view const* src,
+    std::size_t n,
+    ipv6_address* dest) noexcept
+{
+    ipv6_address::bytes_type bytes;
+    std::size_t i = 0;
+    for(; i < n; ++i)
+    {
+        if(! detail::parse_ipv6_text(
+            src[i].data(),
+            src[i].data() + src[i].size(),
+                bytes))
+            break;
+        dest[i] = ipv6_address(bytes);
+    }
+    return i;
+}
+
+std::size_t
+print_ipv6_addresses(
+    ipv6_address const* src,
+    std::size_t n,
+    char* dest,
+    std::size_t size,
+    std::size_t* sizes) noexcept
+{
+    std::size_t i = 0;
+    for(; i < n; ++i)
+    {
+        if(size >= ipv6_address::max_str_len)
+        {
+            // print in place
+            sizes[i] = src[i].to_buffer(
+                dest, size).size();
+        }
+        else
+        {
+            char buf[ipv6_address::max_str_len];
+            sizes[i] = src[i].to_buffer(
+                buf, sizeof(buf)).size();
+            if(sizes[i] > size)
+                break;
+            std::memcpy(dest, buf, sizes[i]);
+        }
+        dest += sizes[i];
+        size -= sizes[i];
+    }
+    return i;
+}
+
 } // urls
 } // boost
 
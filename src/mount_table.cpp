@@ -0,0 +1,178 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/mount_table.hpp>
+#include <boost/url/detail/except.hpp>
+#include "detail/decoded_label.hpp"
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+constexpr std::uint32_t none = 0xffffffff;
+
+} // (anon)
+
+mount_table::
+mount_table()
+    : slots_(16, 0)
+{
+    // the root, which has no segments
+    nodes_.push_back({ none, 0, 0, 0, none });
+}
+
+void
+mount_table::
+grow()
+{
+    std::size_t const n = slots_.size() * 2;
+    std::vector<std::uint32_t> v(n, 0);
+    for(std::size_t id = 1; id < nodes_.size(); ++id)
+    {
+        std::size_t i = nodes_[id].hash & (n - 1);
+        while(v[i] != 0)
+            i = (i + 1) & (n - 1);
+        v[i] = static_cast<std::uint32_t>(id + 1);
+    }
+    slots_ = std::move(v);
+}
+
+std::uint32_t
+mount_table::
+find_child(
+    std::uint32_t parent,
+    core::string_view label) const noexcept
+{
+    auto const h = detail::hash_label(
+        parent, label, false);
+    std::size_t const mask = slots_.size() - 1;
+    std::size_t i = h & mask;
+    for(;;)
+    {
+        auto const slot = slots_[i];
+        if(slot == 0)
+            return none;
+        node const& n = nodes_[slot - 1];
+        if( n.hash == h &&
+            n.parent == parent &&
+            detail::equal_decoded(core::string_view(
+                labels_.data() + n.label, n.size),
+                    label, false))
+            return slot - 1;
+        i = (i + 1) & mask;
+    }
+}
+
+std::uint32_t
+mount_table::
+new_node(
+    std::uint32_t parent,
+    core::string_view label)
+{
+    if(nodes_.size() >= none - 1)
+        detail::throw_length_error();
+    std::string d;
+    detail::for_each_decoded(label, false,
+        [&d](char c)
+        {
+            d.push_back(c);
+        });
+    if(labels_.size() + d.size() > none)
+        detail::throw_length_error();
+    if((nodes_.size() + 1) * 2 > slots_.size())
+        grow();
+    nodes_.reserve(nodes_.size() + 1);
+    labels_.reserve(labels_.size() + d.size());
+
+    auto const id = static_cast<
+        std::uint32_t>(nodes_.size());
+    auto const h = detail::hash_label(
+        parent, label, false);
+    nodes_.push_back({
+        parent,
+        static_cast<std::uint32_t>(labels_.size()),
+        static_cast<std::uint32_t>(d.size()),
+        h, none });
+    labels_.append(d);
+    std::size_t const mask = slots_.size() - 1;
+    std::size_t i = h & mask;
+    while(slots_[i] != 0)
+        i = (i + 1) & mask;
+    slots_[i] = id + 1;
+    return id;
+}
+
+std::size_t
+mount_table::
+add(core::string_view prefix)
+{
+    segments_encoded_view segs(prefix);
+    if(size_ >= none - 1)
+        detail::throw_length_error();
+    std::uint32_t p = 0;
+    auto it = segs.begin();
+    std::size_t n = segs.size();
+    if(n > 0 && segs.back().empty())
+        --n;
+    for(; n > 0; --n, ++it)
+    {
+        auto id = find_child(p, *it);
+        if(id == none)
+            id = new_node(p, *it);
+        p = id;
+    }
+    if(nodes_[p].mount == none)
+        nodes_[p].mount = static_cast<
+            std::uint32_t>(size_++);
+    return nodes_[p].mount;
+}
+
+auto
+mount_table::
+find(segments_encoded_view path) const noexcept ->
+    boost::optional<match>
+{
+    auto it = path.begin();
+    auto const end = path.end();
+    std::uint32_t p = 0;
+    std::uint32_t mount = nodes_[0].mount;
+    auto first = it;
+    while(it != end)
+    {
+        p = find_child(p, *it);
+        if(p == none)
+            break;
+        ++it;
+        if(nodes_[p].mount != none)
+        {
+            mount = nodes_[p].mount;
+            first = it;
+        }
+    }
+    if(mount == none)
+        return boost::none;
+    return match{ mount, first, end };
+}
+
+std::size_t
+mount_table::
+memory_usage() const noexcept
+{
+    return
+        nodes_.capacity() * sizeof(node) +
+        slots_.capacity() * sizeof(std::uint32_t) +
+        labels_.capacity();
+}
+
+} // urls
+} // boost
+
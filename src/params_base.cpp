@@ -209,6 +209,24 @@ count(
 //
 //------------------------------------------------
 
+namespace {
+
+// A key without escapes is compared as-is,
+// which uses the block-wise comparison
+// instead of decoding one char at a time
+bool
+ci_key_equal(
+    pct_string_view k,
+    core::string_view key) noexcept
+{
+    if(k.decoded_size() == k.size())
+        return grammar::ci_is_equal(
+            core::string_view(k), key);
+    return grammar::ci_is_equal(*k, key);
+}
+
+} // (anon)
+
 detail::params_iter_impl
 params_base::
 find_impl(
@@ -232,8 +250,7 @@ find_impl(
     {
         if(it.equal(end_))
             return it;
-        if( grammar::ci_is_equal(
-                *it.key(), key))
+        if(ci_key_equal(it.key(), key))
             return it;
         it.increment();
     }
@@ -263,8 +280,7 @@ find_last_impl(
         if(it.equal(begin_))
             return { ref_, 0 };
         it.decrement();
-        if(grammar::ci_is_equal(
-                *it.key(), key))
+        if(ci_key_equal(it.key(), key))
             return it;
     }
 }
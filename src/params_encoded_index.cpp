@@ -0,0 +1,77 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/params_encoded_index.hpp>
+#include <boost/url/detail/params_iter_impl.hpp>
+
+namespace boost {
+namespace urls {
+
+params_encoded_index::
+params_encoded_index(
+    params_encoded_view const& qp)
+    : ref_(qp.ref_)
+{
+    pos_.reserve(ref_.nparam());
+    detail::params_iter_impl it(ref_);
+    detail::params_iter_impl const end(ref_, 0);
+    while(! it.equal(end))
+    {
+        pos_.push_back(it.pos);
+        it.increment();
+    }
+}
+
+std::size_t
+params_encoded_index::
+offset(std::size_t i) const noexcept
+{
+    BOOST_ASSERT(i < pos_.size());
+    return pos_[i];
+}
+
+auto
+params_encoded_index::
+locate(std::size_t pos) const noexcept ->
+    iterator
+{
+    if( pos_.empty() ||
+        pos >= ref_.buffer().size())
+        return end();
+    // find the first param
+    // starting after pos
+    std::size_t lo = 0;
+    std::size_t hi = pos_.size();
+    while(lo < hi)
+    {
+        std::size_t const mid =
+            lo + (hi - lo) / 2;
+        if(pos_[mid] <= pos)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    BOOST_ASSERT(lo > 0);
+    return iterator(*this, lo - 1);
+}
+
+param_pct_view
+params_encoded_index::
+get(std::size_t i) const noexcept
+{
+    BOOST_ASSERT(i < pos_.size());
+    return detail::params_iter_impl(
+        ref_, pos_[i], i).dereference();
+}
+
+} // urls
+} // boost
+
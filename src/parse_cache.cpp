@@ -0,0 +1,284 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/parse_cache.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/url_hash.hpp>
+#include <boost/url/detail/except.hpp>
+#include "detail/mutex.hpp"
+#include "detail/normalize.hpp"
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// the number of entries in a set
+constexpr std::size_t ways = 8;
+
+} // (anon)
+
+//------------------------------------------------
+
+struct parse_cache::shard
+{
+    struct entry
+    {
+        std::uint64_t hash = 0;
+        std::string key;
+        detail::url_impl impl{
+            detail::url_impl::from::string};
+        std::size_t digest = 0;
+        bool used = false;
+        bool has_digest = false;
+
+        // set when the entry is used, and
+        // cleared as the hand passes it
+        bool ref = false;
+    };
+
+    detail::mutex m;
+    std::unique_ptr<entry[]> entries;
+
+    // the next entry of each set
+    // considered for eviction
+    std::unique_ptr<unsigned char[]> hands;
+
+    // return the entry holding s in
+    // the set, or nullptr
+    entry*
+    find(
+        std::size_t set,
+        std::uint64_t h,
+        core::string_view s) noexcept
+    {
+        entry* e = &entries[set * ways];
+        for(std::size_t i = 0; i < ways; ++i, ++e)
+        {
+            if( e->used &&
+                e->hash == h &&
+                e->key.size() == s.size() &&
+                std::memcmp(e->key.data(),
+                    s.data(), s.size()) == 0)
+                return e;
+        }
+        return nullptr;
+    }
+
+    // return the entry of the set to
+    // replace, which is not used
+    entry&
+    evict(std::size_t set) noexcept
+    {
+        entry* const e = &entries[set * ways];
+        for(std::size_t i = 0; i < ways; ++i)
+            if(! e[i].used)
+                return e[i];
+        unsigned char& hand = hands[set];
+        while(e[hand].ref)
+        {
+            e[hand].ref = false;
+            hand = static_cast<unsigned char>(
+                (hand + 1) % ways);
+        }
+        entry& v = e[hand];
+        hand = static_cast<unsigned char>(
+            (hand + 1) % ways);
+        v.used = false;
+        return v;
+    }
+};
+
+//------------------------------------------------
+
+parse_cache::
+~parse_cache() = default;
+
+parse_cache::
+parse_cache()
+    : parse_cache(options())
+{
+}
+
+parse_cache::
+parse_cache(
+    options const& opt)
+    : max_size_(opt.max_size)
+{
+    if( opt.capacity == 0 ||
+        opt.shards == 0)
+        detail::throw_invalid_argument();
+    std::size_t nshards = 1;
+    while(nshards < opt.shards)
+        nshards *= 2;
+    std::size_t const per_shard =
+        (opt.capacity + nshards - 1) / nshards;
+    std::size_t nsets = 1;
+    while(nsets * ways < per_shard)
+        nsets *= 2;
+    shards_.reset(new shard[nshards]);
+    for(std::size_t i = 0; i < nshards; ++i)
+    {
+        shards_[i].entries.reset(
+            new shard::entry[nsets * ways]);
+        shards_[i].hands.reset(
+            new unsigned char[nsets]());
+    }
+    shard_mask_ = nshards - 1;
+    set_mask_ = nsets - 1;
+    capacity_ = nshards * nsets * ways;
+}
+
+system::result<url_view>
+parse_cache::
+parse_origin_form(
+    core::string_view s)
+{
+    return parse_impl(s, nullptr);
+}
+
+system::result<url_view>
+parse_cache::
+parse_origin_form(
+    core::string_view s,
+    std::size_t& digest)
+{
+    return parse_impl(s, &digest);
+}
+
+system::result<url_view>
+parse_cache::
+parse_impl(
+    core::string_view s,
+    std::size_t* digest)
+{
+    if(s.size() > max_size_)
+    {
+        misses_.fetch_add(1,
+            std::memory_order_relaxed);
+        auto rv = urls::parse_origin_form(s);
+        if(rv && digest)
+            *digest = url_hash()(*rv);
+        return rv;
+    }
+
+    detail::fnv_1a hasher(0);
+    hasher.put(s);
+    std::uint64_t const h =
+        detail::mix_hash(hasher.digest());
+    // the upper bits select the shard, the
+    // lower bits select the set within it
+    shard& sh = shards_[static_cast<
+        std::size_t>(h >> 40) & shard_mask_];
+    std::size_t const set =
+        static_cast<std::size_t>(h) & set_mask_;
+
+    detail::url_impl impl(
+        detail::url_impl::from::string);
+    bool found = false;
+    bool has_digest = false;
+    {
+        detail::lock lock(sh.m);
+        auto* e = sh.find(set, h, s);
+        if(e)
+        {
+            e->ref = true;
+            impl = e->impl;
+            found = true;
+            if(digest && e->has_digest)
+            {
+                *digest = e->digest;
+                has_digest = true;
+            }
+        }
+    }
+    if(found)
+    {
+        hits_.fetch_add(1,
+            std::memory_order_relaxed);
+        impl.cs_ = s.data();
+        url_view u = impl.construct();
+        if( digest &&
+            ! has_digest)
+        {
+            // stored by the overload
+            // without a digest
+            *digest = url_hash()(u);
+            detail::lock lock(sh.m);
+            auto* e = sh.find(set, h, s);
+            if(e)
+            {
+                e->digest = *digest;
+                e->has_digest = true;
+            }
+        }
+        return u;
+    }
+
+    misses_.fetch_add(1,
+        std::memory_order_relaxed);
+    auto rv = urls::parse_origin_form(s);
+    if(! rv)
+        return rv;
+    if(digest)
+        *digest = url_hash()(*rv);
+    url_view_base const& v = *rv;
+
+    detail::lock lock(sh.m);
+    if(sh.find(set, h, s))
+    {
+        // stored by another thread
+        return rv;
+    }
+    auto& e = sh.evict(set);
+    e.key.assign(s.data(), s.size());
+    e.hash = h;
+    e.impl = *v.pi_;
+    e.impl.cs_ = detail::empty_c_str_;
+    e.digest = digest ? *digest : 0;
+    e.has_digest = digest != nullptr;
+    e.ref = false;
+    e.used = true;
+    return rv;
+}
+
+void
+parse_cache::
+clear() noexcept
+{
+    std::size_t const n =
+        (set_mask_ + 1) * ways;
+    for(std::size_t i = 0;
+            i <= shard_mask_; ++i)
+    {
+        shard& sh = shards_[i];
+        detail::lock lock(sh.m);
+        for(std::size_t j = 0; j < n; ++j)
+        {
+            sh.entries[j].used = false;
+            sh.entries[j].ref = false;
+        }
+        for(std::size_t j = 0;
+                j <= set_mask_; ++j)
+            sh.hands[j] = 0;
+    }
+    hits_.store(0,
+        std::memory_order_relaxed);
+    misses_.store(0,
+        std::memory_order_relaxed);
+}
+
+} // urls
+} // boost
+
@@ -0,0 +1,313 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/resolve_into.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include "detail/decode.hpp"
+#include "detail/normalize.hpp"
+#include "rfc/detail/charsets.hpp"
+#include <boost/assert.hpp>
+#include <cstring>
+#include <functional>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// The pieces of the result, in order,
+// before the path is normalized
+struct pieces
+{
+    core::string_view head[2];
+    core::string_view path[2];
+    core::string_view query;
+    core::string_view frag;
+    bool has_authority;
+
+    std::size_t
+    size() const noexcept
+    {
+        return
+            head[0].size() + head[1].size() +
+            path[0].size() + path[1].size() +
+            query.size() + frag.size();
+    }
+};
+
+// the characters of u from p to the end
+core::string_view
+tail(
+    url_view_base const& u,
+    char const* p) noexcept
+{
+    auto const s = u.buffer();
+    return s.substr(p - s.data());
+}
+
+// the characters of u before the path
+core::string_view
+before_path(url_view_base const& u) noexcept
+{
+    auto const s = u.buffer();
+    return s.substr(0,
+        u.encoded_path().data() - s.data());
+}
+
+// the query of u, with the '?'
+core::string_view
+query_part(url_view_base const& u) noexcept
+{
+    if(! u.has_query())
+        return {};
+    auto const q = tail(u,
+        u.encoded_query().data() - 1);
+    if(! u.has_fragment())
+        return q;
+    return q.substr(0, q.size() -
+        u.encoded_fragment().size() - 1);
+}
+
+// the fragment of u, with the '#'
+core::string_view
+frag_part(url_view_base const& u) noexcept
+{
+    if(! u.has_fragment())
+        return {};
+    return tail(u,
+        u.encoded_fragment().data() - 1);
+}
+
+// 5.2.2. Transform References, as
+// performed by url_base::resolve
+void
+transform(
+    url_view_base const& base,
+    url_view_base const& ref,
+    pieces& r) noexcept
+{
+    auto const bp = base.encoded_path();
+    auto const rp = ref.encoded_path();
+    if( ref.has_scheme() &&
+        ref.scheme() != base.scheme())
+    {
+        r.head[0] = before_path(ref);
+        r.path[0] = rp;
+        r.query = query_part(ref);
+        r.frag = frag_part(ref);
+        r.has_authority = ref.has_authority();
+        return;
+    }
+    r.query = query_part(ref);
+    r.frag = frag_part(ref);
+    if(ref.has_authority())
+    {
+        // scheme and ':' of base,
+        // "//" and authority of ref
+        r.head[0] = base.buffer().substr(
+            0, base.scheme().size() + 1);
+        auto const h = before_path(ref);
+        r.head[1] = h.substr(h.size() -
+            ref.encoded_authority().size() - 2);
+        // as in set_encoded_path, a path
+        // which follows an authority and
+        // is not empty starts with '/'
+        if( ! rp.empty() &&
+            ! rp.starts_with('/'))
+        {
+            r.path[0] = "/";
+            r.path[1] = rp;
+        }
+        else
+        {
+            r.path[0] = rp;
+        }
+        r.has_authority = true;
+        return;
+    }
+    r.head[0] = before_path(base);
+    r.has_authority = base.has_authority();
+    if(rp.empty())
+    {
+        r.path[0] = bp;
+        if(! ref.has_query())
+            r.query = query_part(base);
+        if(! ref.has_fragment())
+            r.frag = frag_part(base);
+        return;
+    }
+    if(ref.is_path_absolute())
+    {
+        r.path[0] = rp;
+        return;
+    }
+    // 5.2.3. Merge Paths
+    if( base.has_authority() &&
+        bp.empty())
+        r.path[0] = "/";
+    else
+        r.path[0] = bp.substr(
+            0, bp.rfind('/') + 1);
+    // the segments of ref, which do
+    // not include a leading "./"
+    auto const segs = ref.encoded_segments();
+    if(! segs.empty())
+        r.path[1] = rp.substr(
+            (*segs.begin()).data() - rp.data());
+    // as when editing segments, a path
+    // with no authority which would start
+    // with "//" is prefixed with "/.", and
+    // a relative path whose first segment
+    // is empty is prefixed with "./"
+    if( ! r.has_authority &&
+        r.path[1].starts_with('/'))
+    {
+        if(r.path[0] == "/")
+            r.path[0] = "/./";
+        else if(r.path[0].empty())
+            r.path[0] = "./";
+    }
+}
+
+// normalize the path in place, as
+// url_base::normalize_path does for
+// a url with a scheme, returning the
+// new size
+std::size_t
+normalize_path(
+    char* const p,
+    std::size_t n,
+    bool has_authority) noexcept
+{
+    // decode unreserved octets and
+    // uppercase percent-encodings
+    char const* it = p;
+    char const* const end = p + n;
+    char* dest = p;
+    while(it != end)
+    {
+        if(*it != '%')
+        {
+            *dest++ = *it++;
+            continue;
+        }
+        BOOST_ASSERT(end - it >= 3);
+        char const d =
+            detail::decode_one(it + 1);
+        if(detail::segment_chars(d))
+        {
+            *dest++ = d;
+            it += 3;
+            continue;
+        }
+        *dest++ = '%';
+        ++it;
+        *dest++ = grammar::to_upper(*it++);
+        *dest++ = grammar::to_upper(*it++);
+    }
+    core::string_view s(p, dest - p);
+
+    // keep initial dot segments whose
+    // removal would leave "//"
+    std::size_t skip = 0;
+    if( ! has_authority &&
+        s.starts_with("/./"))
+    {
+        skip = 2;
+        while(s.substr(skip, 3).starts_with("/./"))
+            skip += 2;
+        if(s.substr(skip).starts_with("//"))
+            skip = 2;
+        else
+            skip = 0;
+    }
+    return skip + detail::remove_dot_segments(
+        p + skip, dest, s.substr(skip));
+}
+
+char*
+put(char* dest, core::string_view s) noexcept
+{
+    if(! s.empty())
+        std::memcpy(dest, s.data(), s.size());
+    return dest + s.size();
+}
+
+// write the result, which fits
+std::size_t
+write(
+    pieces const& r,
+    char* const dest) noexcept
+{
+    char* it = dest;
+    it = put(it, r.head[0]);
+    it = put(it, r.head[1]);
+    char* const path = it;
+    it = put(it, r.path[0]);
+    it = put(it, r.path[1]);
+    it = path + normalize_path(
+        path, it - path, r.has_authority);
+    it = put(it, r.query);
+    it = put(it, r.frag);
+    return it - dest;
+}
+
+bool
+overlaps(
+    char const* dest,
+    std::size_t size,
+    core::string_view s) noexcept
+{
+    std::less<char const*> lt;
+    return
+        lt(dest, s.data() + s.size()) &&
+        lt(s.data(), dest + size);
+}
+
+} // (anon)
+
+system::result<std::size_t>
+resolve_into(
+    url_view_base const& base,
+    url_view_base const& ref,
+    char* dest,
+    std::size_t size) noexcept
+{
+    if(! base.has_scheme())
+    {
+        BOOST_URL_RETURN_EC(error::not_a_base);
+    }
+    pieces r{};
+    transform(base, ref, r);
+    if(r.size() > size)
+    {
+        BOOST_URL_RETURN_EC(error::no_space);
+    }
+    BOOST_ASSERT(! overlaps(
+        dest, size, base.buffer()));
+    BOOST_ASSERT(! overlaps(
+        dest, size, ref.buffer()));
+    return write(r, dest);
+}
+
+system::result<void>
+resolve_into(
+    url_view_base const& base,
+    url_view_base const& ref,
+    static_url_base& dest) noexcept
+{
+    return dest.resolve_into_impl(base, ref);
+}
+
+} // urls
+} // boost
+
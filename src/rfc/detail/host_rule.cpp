@@ -9,11 +9,15 @@
 
 
 #include <boost/url/detail/config.hpp>
-#include <boost/url/rfc/ipv4_address_rule.hpp>
+#include "charsets.hpp"
 #include "host_rule.hpp"
 #include "ip_literal_rule.hpp"
-#include "reg_name_rule.hpp"
+#include <boost/url/grammar/charset.hpp>
+#include <boost/url/grammar/digit_chars.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
 #include <boost/url/grammar/parse.hpp>
+#include <cstring>
 
 namespace boost {
 namespace urls {
@@ -71,58 +75,115 @@ parse(
         return t;
     }
 
-    // IPv4address
+    // IPv4address / reg-name
+    //
+    // The host is scanned once. Digits and
+    // dots at the start are accumulated as
+    // speculative octets; the result is an
+    // IPv4address only if a valid dotted
+    // quad is not followed by more reg-name.
+    auto p = it;
+    std::size_t dn = 0;
+    unsigned char addr[4];
+    char const* quad_end = nullptr;
     {
-        auto rv = grammar::parse(
-            it, end, ipv4_address_rule);
-        if( rv )
+        unsigned v = 0;
+        std::size_t nd = 0;
+        std::size_t k = 0;
+        while(p != end)
         {
-            auto it02 = it;
-            auto rv2 = grammar::parse(
-                it, end,
-                detail::reg_name_rule);
-            if (rv2.has_value() &&
-                !rv2->empty())
+            auto const c = *p;
+            if(grammar::digit_chars(c))
             {
-                t.name = core::string_view(
-                    it0, it - it0);
-                t.host_type =
-                    urls::host_type::name;
-                t.match = core::string_view(
-                    it0, it - it0);
-                return t;
+                if( nd == 1 &&
+                    v == 0)
+                {
+                    // leading '0'
+                    break;
+                }
+                v = 10 * v + (c - '0');
+                if(v > 255)
+                {
+                    // integer overflow
+                    break;
+                }
+                ++nd;
             }
-            it = it02;
-            auto const b =
-                rv->to_bytes();
-            std::memcpy(
-                t.addr,
-                b.data(),
-                b.size());
-            t.host_type =
-                urls::host_type::ipv4;
-            t.match = core::string_view(
-                it0, it - it0);
-            return t;
+            else if(
+                c == '.' &&
+                nd > 0 &&
+                k < 3)
+            {
+                addr[k++] =
+                    static_cast<unsigned char>(v);
+                v = 0;
+                nd = 0;
+            }
+            else
+            {
+                break;
+            }
+            ++p;
+            ++dn;
+        }
+        if( k == 3 &&
+            nd > 0 &&
+            ( p == end ||
+              ! grammar::digit_chars(*p)))
+        {
+            addr[3] =
+                static_cast<unsigned char>(v);
+            quad_end = p;
         }
-
-        it = it0; // rewind
     }
 
-    // reg-name
+    // the rest of the reg-name
+    for(;;)
     {
-        auto rv = grammar::parse(
-            it, end,
-            detail::reg_name_rule);
-        if(! rv)
-            return rv.error();
-        t.name = *rv;
+        auto const p0 = p;
+        p = grammar::find_if_not(
+            p, end, host_chars);
+        dn += p - p0;
+        if( p == end ||
+            *p != '%')
+            break;
+        if( end - p < 3 ||
+            grammar::hexdig_value(p[1]) < 0 ||
+            grammar::hexdig_value(p[2]) < 0)
+        {
+            if(quad_end)
+            {
+                // IPv4address followed
+                // by a bad escape
+                p = quad_end;
+                break;
+            }
+            // expected HEXDIG
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        }
+        p += 3;
+        ++dn;
+    }
+    if(p == quad_end)
+    {
+        std::memcpy(
+            t.addr, addr, sizeof(addr));
         t.host_type =
-            urls::host_type::name;
+            urls::host_type::ipv4;
+        it = p;
         t.match = core::string_view(
             it0, it - it0);
         return t;
     }
+    it = p;
+    t.name = make_pct_string_view_unsafe(
+        it0, it - it0, dn);
+    t.host_type =
+        urls::host_type::name;
+    t.match = core::string_view(
+        it0, it - it0);
+    return t;
 }
 
 } // detail
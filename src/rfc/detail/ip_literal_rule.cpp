@@ -17,6 +17,9 @@
 #include <boost/url/grammar/parse.hpp>
 #include <boost/url/grammar/tuple_rule.hpp>
 #include "ipvfuture_rule.hpp"
+#include "../../detail/ipv6_text.hpp"
+#include <algorithm>
+#include <cstring>
 
 namespace boost {
 namespace urls {
@@ -31,6 +34,7 @@ parse(
     system::result<value_type>
 {
     value_type t;
+    ipv6_address::bytes_type bytes;
 
     // '['
     {
@@ -48,7 +52,25 @@ parse(
     if(*it != 'v')
     {
         // IPv6address
+        // the search is bounded by the
+        // longest address, so that it does
+        // not examine the rest of the input
         auto it0 = it;
+        std::size_t const n = (std::min)(
+            static_cast<std::size_t>(end - it),
+            ipv6_address::max_str_len);
+        auto const close = static_cast<
+            char const*>(std::memchr(
+                it, ']', n));
+        if( close &&
+            parse_ipv6_text(
+                it, close, bytes))
+        {
+            it = close + 1;
+            t.ipv6 = ipv6_address(bytes);
+            t.is_ipv6 = true;
+            return t;
+        }
         auto rv = grammar::parse(
             it, end,
             grammar::tuple_rule(
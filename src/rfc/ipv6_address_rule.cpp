@@ -60,7 +60,7 @@ parse(
                     // when '::' seen
     bool c = false; // need colon
     auto prev = it;
-    ipv6_address::bytes_type bytes;
+    ipv6_address::bytes_type bytes{};
     system::result<detail::h16_rule_t::value_type> rv;
     for(;;)
     {
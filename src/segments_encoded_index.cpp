@@ -0,0 +1,81 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/segments_encoded_index.hpp>
+#include <boost/url/detail/segments_iter_impl.hpp>
+
+namespace boost {
+namespace urls {
+
+segments_encoded_index::
+segments_encoded_index(
+    segments_encoded_view const& ps)
+    : ref_(ps.ref_)
+{
+    pos_.reserve(ref_.nseg());
+    detail::segments_iter_impl it(ref_);
+    detail::segments_iter_impl const end(ref_, 0);
+    while(! it.equal(end))
+    {
+        pos_.push_back(it.pos);
+        it.increment();
+    }
+}
+
+std::size_t
+segments_encoded_index::
+offset(std::size_t i) const noexcept
+{
+    BOOST_ASSERT(i < pos_.size());
+    if(i == 0)
+        return pos_[0];
+    // skip '/'
+    return pos_[i] + 1;
+}
+
+auto
+segments_encoded_index::
+locate(std::size_t pos) const noexcept ->
+    iterator
+{
+    if( pos_.empty() ||
+        pos >= ref_.size())
+        return end();
+    // find the first segment
+    // starting after pos
+    std::size_t lo = 0;
+    std::size_t hi = pos_.size();
+    while(lo < hi)
+    {
+        std::size_t const mid =
+            lo + (hi - lo) / 2;
+        if(offset(mid) <= pos)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if(lo == 0)
+        return begin();
+    return iterator(*this, lo - 1);
+}
+
+pct_string_view
+segments_encoded_index::
+get(std::size_t i) const noexcept
+{
+    BOOST_ASSERT(i < pos_.size());
+    return detail::segments_iter_impl(
+        ref_, pos_[i], i).dereference();
+}
+
+} // urls
+} // boost
+
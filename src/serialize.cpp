@@ -0,0 +1,251 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/serialize.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <boost/assert.hpp>
+#include <cstdint>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+/*  Record layout, integers are little endian
+
+    1   version
+    1   host_type
+    1   scheme
+    1   zero
+    2   port_number
+    32  offset_[ 0 .. id_end ]
+    28  decoded_[ 0 .. id_end - 1 ]
+    4   nseg
+    4   nparam
+    N   ip_addr, 4 for ipv4, 16 for ipv6, else 0
+    N   characters
+*/
+struct url_record : parts_base
+{
+    static constexpr unsigned char version = 1;
+
+    static constexpr std::size_t header_size =
+        6 + 4 * ( (id_end + 1) + id_end + 2 );
+
+    static
+    std::size_t
+    addr_size(host_type ht) noexcept
+    {
+        switch(ht)
+        {
+        case host_type::ipv4:
+            return 4;
+        case host_type::ipv6:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    static
+    char*
+    put16(char* p, std::size_t v) noexcept
+    {
+        p[0] = static_cast<char>(v & 0xff);
+        p[1] = static_cast<char>((v >> 8) & 0xff);
+        return p + 2;
+    }
+
+    static
+    char*
+    put32(char* p, std::size_t v) noexcept
+    {
+        p = put16(p, v & 0xffff);
+        return put16(p, (v >> 16) & 0xffff);
+    }
+
+    static
+    std::uint16_t
+    get16(char const* p) noexcept
+    {
+        auto const b = reinterpret_cast<
+            unsigned char const*>(p);
+        return static_cast<std::uint16_t>(
+            b[0] | (b[1] << 8));
+    }
+
+    static
+    std::uint32_t
+    get32(char const* p) noexcept
+    {
+        return get16(p) |
+            (static_cast<std::uint32_t>(
+                get16(p + 2)) << 16);
+    }
+
+    static
+    url_impl const&
+    impl(url_view_base const& u) noexcept
+    {
+        return *u.pi_;
+    }
+};
+
+constexpr unsigned char url_record::version;
+constexpr std::size_t url_record::header_size;
+
+} // detail
+
+std::size_t
+serialized_size(
+    url_view_base const& u) noexcept
+{
+    using R = detail::url_record;
+    return R::header_size +
+        R::addr_size(u.host_type()) +
+        u.size();
+}
+
+std::size_t
+serialize_url(
+    char* dest,
+    std::size_t size,
+    url_view_base const& u) noexcept
+{
+    using R = detail::url_record;
+    auto const n = serialized_size(u);
+    if( size < n ||
+        u.size() > 0xffffffff)
+        return 0;
+    auto const& impl = R::impl(u);
+    char* p = dest;
+    *p++ = static_cast<char>(R::version);
+    *p++ = static_cast<char>(impl.host_type_);
+    *p++ = static_cast<char>(impl.scheme_);
+    *p++ = 0;
+    p = R::put16(p, impl.port_number_);
+    for(int id = 0; id <= R::id_end; ++id)
+        p = R::put32(p, impl.offset_[id]);
+    for(int id = 0; id < R::id_end; ++id)
+        p = R::put32(p, impl.decoded_[id]);
+    p = R::put32(p, impl.nseg_);
+    p = R::put32(p, impl.nparam_);
+    auto const na = R::addr_size(impl.host_type_);
+    std::memcpy(p, impl.ip_addr_, na);
+    p += na;
+    std::memcpy(p, u.data(), u.size());
+    p += u.size();
+    BOOST_ASSERT(
+        static_cast<std::size_t>(p - dest) == n);
+    return n;
+}
+
+system::result<url_view>
+deserialize_url(
+    char const*& it,
+    char const* end) noexcept
+{
+    using R = detail::url_record;
+    auto const avail = static_cast<
+        std::size_t>(end - it);
+    if(avail < R::header_size)
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::need_more);
+    }
+    char const* p = it;
+    if( static_cast<unsigned char>(
+            p[0]) != R::version ||
+        static_cast<unsigned char>(
+            p[1]) > static_cast<unsigned char>(
+                host_type::ipvfuture) ||
+        static_cast<unsigned char>(
+            p[2]) > static_cast<unsigned char>(
+                scheme::wss) ||
+        p[3] != 0)
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+    }
+    detail::url_impl impl(
+        detail::url_impl::from::string);
+    impl.host_type_ = static_cast<
+        host_type>(p[1]);
+    impl.scheme_ = static_cast<
+        scheme>(p[2]);
+    impl.port_number_ = R::get16(p + 4);
+    p += 6;
+    std::size_t prev = 0;
+    for(int id = 0; id <= R::id_end; ++id)
+    {
+        impl.offset_[id] = R::get32(p);
+        p += 4;
+        if(impl.offset_[id] < prev)
+        {
+            // offsets must not decrease
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        }
+        prev = impl.offset_[id];
+    }
+    for(int id = 0; id < R::id_end; ++id)
+    {
+        impl.decoded_[id] = R::get32(p);
+        p += 4;
+        if(impl.decoded_[id] > impl.len(id))
+        {
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        }
+    }
+    impl.nseg_ = R::get32(p);
+    impl.nparam_ = R::get32(p + 4);
+    p += 8;
+    if( impl.nseg_ > impl.len(R::id_path) ||
+        impl.nparam_ > impl.len(R::id_query))
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+    }
+    auto const na = R::addr_size(impl.host_type_);
+    auto const n = impl.offset_[R::id_end];
+    if(avail - R::header_size < na + n)
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::need_more);
+    }
+    std::memcpy(impl.ip_addr_, p, na);
+    p += na;
+    impl.cs_ = p;
+    it = p + n;
+    return impl.construct();
+}
+
+system::result<url_view>
+deserialize_url(
+    core::string_view s) noexcept
+{
+    char const* it = s.data();
+    char const* const end = it + s.size();
+    auto rv = deserialize_url(it, end);
+    if(! rv)
+        return rv.error();
+    if(it != end)
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::leftover);
+    }
+    return rv;
+}
+
+} // urls
+} // boost
+
@@ -0,0 +1,43 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/shared_url.hpp>
+#include <boost/url/parse.hpp>
+
+namespace boost {
+namespace urls {
+
+shared_url::
+shared_url(core::string_view s)
+    : shared_url(parse_uri_reference(s
+        ).value(BOOST_URL_POS))
+{
+}
+
+shared_url::
+shared_url(url_view_base const& u)
+    : sp_(u.persist())
+{
+}
+
+url_view const&
+shared_url::
+get() const noexcept
+{
+    if(sp_)
+        return *sp_;
+    static url_view const empty;
+    return empty;
+}
+
+} // urls
+} // boost
+
@@ -0,0 +1,147 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/small_url.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/assert.hpp>
+#include "detail/alloc_stats.hpp"
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+small_url_base::
+~small_url_base()
+{
+    if(s_ != buf_)
+        delete[] s_;
+}
+
+small_url_base::
+small_url_base(
+    char* buf,
+    std::size_t cap) noexcept
+    : buf_(buf)
+    , n_(cap)
+{
+    s_ = buf;
+    cap_ = cap;
+    s_[0] = '\0';
+    impl_.cs_ = s_;
+}
+
+small_url_base::
+small_url_base(
+    char* buf,
+    std::size_t cap,
+    core::string_view s)
+    : small_url_base(buf, cap)
+{
+    copy(parse_uri_reference(s
+        ).value(BOOST_URL_POS));
+}
+
+void
+small_url_base::
+clear_impl() noexcept
+{
+    // preserve capacity
+    impl_ = {from::url};
+    s_[0] = '\0';
+    impl_.cs_ = s_;
+}
+
+void
+small_url_base::
+reserve_impl(
+    std::size_t n,
+    op_t& op)
+{
+    if(n > max_size())
+        detail::throw_length_error();
+    if(n <= cap_)
+        return;
+    // 50% growth policy, as url
+    auto const h = cap_ / 2;
+    std::size_t new_cap;
+    if(cap_ <= max_size() - h)
+        new_cap = cap_ + h;
+    else
+        new_cap = max_size();
+    if( new_cap < n)
+        new_cap = n;
+    char* s = new char[new_cap + 1];
+    std::memcpy(s, s_, size() + 1);
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+    detail::count_allocate(
+        stats_, new_cap, true);
+    detail::count_copy(
+        stats_, size() + 1);
+#endif
+    // the inline buffer outlives the
+    // operation, so only a previous
+    // heap buffer must be released.
+    if(s_ != buf_)
+    {
+        BOOST_ASSERT(! op.old);
+        op.old = s_;
+    }
+    s_ = s;
+    cap_ = new_cap;
+    impl_.cs_ = s_;
+}
+
+void
+small_url_base::
+cleanup(op_t& op)
+{
+    BOOST_ASSERT(op.old != buf_);
+    delete[] op.old;
+}
+
+void
+small_url_base::
+take(small_url_base& u) noexcept
+{
+    if(this == &u)
+        return;
+    if(u.s_ != u.buf_)
+    {
+        // transfer ownership
+        if(s_ != buf_)
+            delete[] s_;
+        s_ = u.s_;
+        cap_ = u.cap_;
+        impl_ = u.impl_;
+        u.s_ = u.buf_;
+        u.cap_ = u.n_;
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+        stats_ = u.stats_;
+        u.stats_ = {};
+#endif
+    }
+    else
+    {
+        // the inline buffers have the
+        // same capacity, so this fits.
+        BOOST_ASSERT(u.size() <= cap_);
+        impl_ = u.impl_;
+        std::memcpy(s_, u.s_, u.size() + 1);
+    }
+    impl_.cs_ = s_;
+    u.clear_impl();
+}
+
+} // urls
+} // boost
+
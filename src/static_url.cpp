@@ -10,6 +10,7 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/parse.hpp>
+#include <boost/url/resolve_into.hpp>
 #include <boost/url/static_url.hpp>
 #include <boost/url/url_view.hpp>
 #include <boost/url/detail/except.hpp>
@@ -60,6 +61,35 @@ reserve_impl(
     detail::throw_length_error();
 }
 
+system::result<void>
+static_url_base::
+resolve_into_impl(
+    url_view_base const& base,
+    url_view_base const& ref) noexcept
+{
+    BOOST_ASSERT(this != &base);
+    BOOST_ASSERT(this != &ref);
+    auto rn = resolve_into(
+        base, ref, s_, cap_);
+    if(! rn)
+        return rn.error();
+    s_[*rn] = '\0';
+    auto rv = parse_uri_reference(
+        core::string_view(s_, *rn));
+    if(! rv)
+    {
+        // LCOV_EXCL_START
+        clear_impl();
+        return rv.error();
+        // LCOV_EXCL_STOP
+    }
+    url_view_base const& u = *rv;
+    impl_ = *u.pi_;
+    impl_.cs_ = s_;
+    impl_.from_ = {from::url};
+    return {};
+}
+
 //----------------------------------------------------------
 
 // LCOV_EXCL_START
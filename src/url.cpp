@@ -13,6 +13,7 @@
 #include <boost/url/url.hpp>
 #include <boost/url/parse.hpp>
 #include <boost/assert.hpp>
+#include "detail/alloc_stats.hpp"
 
 namespace boost {
 namespace urls {
@@ -50,6 +51,10 @@ url(url&& u) noexcept
     u.s_ = nullptr;
     u.cap_ = 0;
     u.impl_ = {from::url};
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+    stats_ = u.stats_;
+    u.stats_ = {};
+#endif
 }
 
 url&
@@ -64,6 +69,10 @@ operator=(url&& u) noexcept
     u.s_ = nullptr;
     u.cap_ = 0;
     u.impl_ = {from::url};
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+    stats_ = u.stats_;
+    u.stats_ = {};
+#endif
     return *this;
 }
 
@@ -126,6 +135,12 @@ reserve_impl(
             new_cap = n;
         s = allocate(new_cap);
         std::memcpy(s, s_, size() + 1);
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+        detail::count_allocate(
+            stats_, new_cap, true);
+        detail::count_copy(
+            stats_, size() + 1);
+#endif
         BOOST_ASSERT(! op.old);
         op.old = s_;
         s_ = s;
@@ -134,6 +149,10 @@ reserve_impl(
     {
         s_ = allocate(n);
         s_[0] = '\0';
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+        detail::count_allocate(
+            stats_, n, false);
+#endif
     }
     impl_.cs_ = s_;
 }
@@ -158,6 +177,9 @@ swap(url& other) noexcept
     std::swap(s_, other.s_);
     std::swap(cap_, other.cap_);
     std::swap(impl_, other.impl_);
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+    std::swap(stats_, other.stats_);
+#endif
     std::swap(pi_, other.pi_);
     if (pi_ == &other.impl_)
         pi_ = &impl_;
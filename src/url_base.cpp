@@ -19,6 +19,7 @@
 #include <boost/url/detail/any_params_iter.hpp>
 #include <boost/url/detail/any_segments_iter.hpp>
 #include "detail/decode.hpp"
+#include "detail/ipv6_text.hpp"
 #include <boost/url/detail/encode.hpp>
 #include <boost/url/detail/except.hpp>
 #include "detail/normalize.hpp"
@@ -35,6 +36,7 @@
 #include "rfc/detail/scheme_rule.hpp"
 #include "rfc/detail/userinfo_rule.hpp"
 #include <boost/url/grammar/parse.hpp>
+#include "detail/alloc_stats.hpp"
 #include "detail/move_chars.hpp"
 #include <cstring>
 #include <iostream>
@@ -82,6 +84,9 @@ move(
 {
     if(! n)
         return;
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+    detail::count_move(u.stats_, n);
+#endif
     if(s0)
     {
         if(s1)
@@ -1695,6 +1700,17 @@ url_base&
 url_base::
 normalize_authority()
 {
+    // IPv6address in canonical form
+    {
+        char buf[detail::normalized_host_max];
+        auto const s = detail::normalized_host(
+            encoded_host(), host_type(),
+            host_ipv6_address(), buf);
+        if(s.data() == buf &&
+            s != encoded_host())
+            set_host_ipv6(host_ipv6_address());
+    }
+
     op_t op(*this);
 
     // normalize host
@@ -1868,8 +1884,10 @@ normalize_path()
         if (p == "/")
             impl_.nseg_ = 0;
         else if (!p.empty())
-            impl_.nseg_ = std::count(
-                p.begin() + 1, p.end(), '/') + 1;
+            // discount a remaining "/." or "."
+            // prefix, as the parser does
+            impl_.nseg_ = detail::path_segments(p,
+                std::count(p.begin() + 1, p.end(), '/') + 1);
         else
             impl_.nseg_ = 0;
         impl_.decoded_[id_path] =
@@ -0,0 +1,482 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_blocklist.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/grammar/error.hpp>
+#include "detail/decoded_label.hpp"
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+constexpr std::uint32_t none = 0xffffffff;
+
+// format of the serialized tables
+constexpr char magic[4] = { 'u', 'r', 'b', 'l' };
+constexpr std::uint32_t version = 1;
+
+// return the size of the dot, which may be
+// percent-encoded, ending at `it`, or zero
+std::size_t
+dot_before(
+    char const* begin,
+    char const* it) noexcept
+{
+    if( it - begin >= 1 &&
+        it[-1] == '.')
+        return 1;
+    if( it - begin >= 3 &&
+        it[-3] == '%' &&
+        it[-2] == '2' &&
+        (it[-1] == 'E' || it[-1] == 'e'))
+        return 3;
+    return 0;
+}
+
+// return the size of the dot, which may be
+// percent-encoded, starting at `it`, or zero
+std::size_t
+dot_after(
+    char const* it,
+    char const* end) noexcept
+{
+    if( end - it >= 1 &&
+        it[0] == '.')
+        return 1;
+    if( end - it >= 3 &&
+        it[0] == '%' &&
+        it[1] == '2' &&
+        (it[2] == 'E' || it[2] == 'e'))
+        return 3;
+    return 0;
+}
+
+// invoke f with each label of the host,
+// from right to left, until f returns false.
+// labels are split on decoded dots, so that
+// "example%2Ecom" has the same labels
+// as "example.com"
+template<class F>
+void
+for_each_label(
+    core::string_view s,
+    F const& f)
+{
+    auto begin = s.data();
+    auto end = begin + s.size();
+    begin += dot_after(begin, end);
+    end -= dot_before(begin, end);
+    if(begin == end)
+        return;
+    for(;;)
+    {
+        auto it = end;
+        std::size_t n = 0;
+        while( it != begin &&
+            (n = dot_before(begin, it)) == 0)
+            --it;
+        if(! f(core::string_view(
+                it, end - it)))
+            return;
+        if(it == begin)
+            return;
+        end = it - n;
+    }
+}
+
+// return 1 or 2 if the decoded
+// segment is "." or "..", else zero
+std::size_t
+dot_segment(core::string_view seg) noexcept
+{
+    auto it = seg.data();
+    auto const end = it + seg.size();
+    std::size_t n = 0;
+    while(it != end)
+    {
+        auto const m = dot_after(it, end);
+        if( m == 0 ||
+            ++n > 2)
+            return 0;
+        it += m;
+    }
+    return n;
+}
+
+// the size of a serialized node
+constexpr std::size_t node_bytes = 6 * 4;
+
+void
+put_u32(
+    std::string& s,
+    std::uint32_t v)
+{
+    char b[4];
+    for(int i = 0; i < 4; ++i)
+        b[i] = static_cast<char>(
+            (v >> (8 * i)) & 0xff);
+    s.append(b, 4);
+}
+
+std::uint32_t
+get_u32(char const*& p) noexcept
+{
+    std::uint32_t v = 0;
+    for(int i = 0; i < 4; ++i)
+        v |= static_cast<std::uint32_t>(
+            static_cast<unsigned char>(
+                *p++)) << (8 * i);
+    return v;
+}
+
+} // (anon)
+
+//------------------------------------------------
+
+url_blocklist::
+url_blocklist()
+    : slots_(16, 0)
+{
+    // the root of the host trie
+    nodes_.push_back({ none, 0, 0, 0, none, none });
+}
+
+void
+url_blocklist::
+grow()
+{
+    std::size_t const n = slots_.size() * 2;
+    std::vector<std::uint32_t> v(n, 0);
+    for(std::size_t id = 0; id < nodes_.size(); ++id)
+    {
+        if(nodes_[id].parent == none)
+            continue;
+        std::size_t i = nodes_[id].hash & (n - 1);
+        while(v[i] != 0)
+            i = (i + 1) & (n - 1);
+        v[i] = static_cast<std::uint32_t>(id + 1);
+    }
+    slots_ = std::move(v);
+}
+
+std::uint32_t
+url_blocklist::
+find_child(
+    std::uint32_t parent,
+    core::string_view label,
+    bool icase) const noexcept
+{
+    auto const h = detail::hash_label(
+        parent, label, icase);
+    std::size_t const mask = slots_.size() - 1;
+    std::size_t i = h & mask;
+    for(;;)
+    {
+        auto const slot = slots_[i];
+        if(slot == 0)
+            return none;
+        node const& n = nodes_[slot - 1];
+        if( n.hash == h &&
+            n.parent == parent &&
+            detail::equal_decoded(core::string_view(
+                labels_.data() + n.label, n.size),
+                    label, icase))
+            return slot - 1;
+        i = (i + 1) & mask;
+    }
+}
+
+std::uint32_t
+url_blocklist::
+new_node(
+    std::uint32_t parent,
+    core::string_view label,
+    bool icase)
+{
+    if(nodes_.size() >= none - 1)
+        detail::throw_length_error();
+    std::string d;
+    detail::for_each_decoded(label, icase,
+        [&d](char c)
+        {
+            d.push_back(c);
+        });
+    if(labels_.size() + d.size() > none)
+        detail::throw_length_error();
+    if((nodes_.size() + 1) * 2 > slots_.size())
+        grow();
+    nodes_.reserve(nodes_.size() + 1);
+    labels_.reserve(labels_.size() + d.size());
+
+    auto const id = static_cast<
+        std::uint32_t>(nodes_.size());
+    auto const h = detail::hash_label(
+        parent, label, icase);
+    nodes_.push_back({
+        parent,
+        static_cast<std::uint32_t>(labels_.size()),
+        static_cast<std::uint32_t>(d.size()),
+        h, none, none });
+    labels_.append(d);
+    if(parent == none)
+        return id;
+    std::size_t const mask = slots_.size() - 1;
+    std::size_t i = h & mask;
+    while(slots_[i] != 0)
+        i = (i + 1) & mask;
+    slots_[i] = id + 1;
+    return id;
+}
+
+std::size_t
+url_blocklist::
+add(
+    core::string_view host,
+    core::string_view path)
+{
+    // validate everything first
+    make_pct_string_view(host).value();
+    segments_encoded_view segs(path);
+    if(rules_ >= none - 1)
+        detail::throw_length_error();
+
+    std::uint32_t h = 0;
+    for_each_label(host,
+        [&](core::string_view label)
+        {
+            auto id = find_child(h, label, true);
+            if(id == none)
+                id = new_node(h, label, true);
+            h = id;
+            return true;
+        });
+
+    std::uint32_t p = nodes_[h].sub;
+    if(p == none)
+    {
+        p = new_node(none, {}, false);
+        nodes_[h].sub = p;
+    }
+    auto it = segs.begin();
+    std::size_t n = segs.size();
+    if(n > 0 && segs.back().empty())
+        --n;
+    for(; n > 0; --n, ++it)
+    {
+        auto id = find_child(p, *it, false);
+        if(id == none)
+            id = new_node(p, *it, false);
+        p = id;
+    }
+    if(nodes_[p].rule == none)
+        nodes_[p].rule = static_cast<
+            std::uint32_t>(rules_++);
+    return nodes_[p].rule;
+}
+
+template<class Segments>
+std::uint32_t
+url_blocklist::
+find_rule(
+    std::uint32_t p,
+    Segments const& segs) const noexcept
+{
+    if(p == none)
+        return none;
+    if(nodes_[p].rule != none)
+        return nodes_[p].rule;
+    for(core::string_view seg : segs)
+    {
+        p = find_child(p, seg, false);
+        if(p == none)
+            return none;
+        if(nodes_[p].rule != none)
+            return nodes_[p].rule;
+    }
+    return none;
+}
+
+boost::optional<std::size_t>
+url_blocklist::
+find(url_view_base const& u) const
+{
+    auto const segs = u.encoded_segments();
+
+    // remove dot segments, so that "/a/../admin"
+    // is checked as "/admin". The segments are
+    // only copied when the path has some.
+    std::vector<core::string_view> v;
+    bool dots = false;
+    for(core::string_view seg : segs)
+    {
+        if(dot_segment(seg) != 0)
+        {
+            dots = true;
+            break;
+        }
+    }
+    if(dots)
+    {
+        for(core::string_view seg : segs)
+        {
+            auto const n = dot_segment(seg);
+            if(n == 1)
+                continue;
+            if(n == 2)
+            {
+                if(! v.empty())
+                    v.pop_back();
+                continue;
+            }
+            v.push_back(seg);
+        }
+    }
+    auto const rule_of =
+        [&](std::uint32_t p)
+        {
+            if(dots)
+                return find_rule(p, v);
+            return find_rule(p, segs);
+        };
+
+    std::uint32_t h = 0;
+    std::uint32_t rule = rule_of(
+        nodes_[h].sub);
+    if(rule == none)
+    {
+        for_each_label(u.encoded_host(),
+            [&](core::string_view label)
+            {
+                h = find_child(h, label, true);
+                if(h == none)
+                    return false;
+                rule = rule_of(
+                    nodes_[h].sub);
+                return rule == none;
+            });
+    }
+    if(rule == none)
+        return boost::none;
+    return rule;
+}
+
+std::size_t
+url_blocklist::
+memory_usage() const noexcept
+{
+    return
+        nodes_.capacity() * sizeof(node) +
+        slots_.capacity() * sizeof(std::uint32_t) +
+        labels_.capacity();
+}
+
+//------------------------------------------------
+
+std::string
+url_blocklist::
+serialize() const
+{
+    std::string s;
+    s.reserve(24 +
+        nodes_.size() * node_bytes +
+        slots_.size() * 4 +
+        labels_.size());
+    s.append(magic, 4);
+    put_u32(s, version);
+    put_u32(s, static_cast<std::uint32_t>(rules_));
+    put_u32(s, static_cast<std::uint32_t>(nodes_.size()));
+    put_u32(s, static_cast<std::uint32_t>(slots_.size()));
+    put_u32(s, static_cast<std::uint32_t>(labels_.size()));
+    for(auto const& n : nodes_)
+    {
+        put_u32(s, n.parent);
+        put_u32(s, n.label);
+        put_u32(s, n.size);
+        put_u32(s, n.hash);
+        put_u32(s, n.rule);
+        put_u32(s, n.sub);
+    }
+    for(auto v : slots_)
+        put_u32(s, v);
+    s.append(labels_);
+    return s;
+}
+
+system::result<url_blocklist>
+url_blocklist::
+deserialize(core::string_view s)
+{
+    auto const bad = [](){
+        return system::result<url_blocklist>(
+            grammar::error::invalid); };
+
+    if( s.size() < 24 ||
+        std::memcmp(s.data(), magic, 4) != 0)
+        return bad();
+    char const* p = s.data() + 4;
+    if(get_u32(p) != version)
+        return bad();
+    std::uint64_t const rules = get_u32(p);
+    std::uint64_t const nodes = get_u32(p);
+    std::uint64_t const slots = get_u32(p);
+    std::uint64_t const labels = get_u32(p);
+    if( nodes == 0 ||
+        slots < 2 * nodes ||
+        (slots & (slots - 1)) != 0 ||
+        s.size() != 24 + nodes * node_bytes +
+            slots * 4 + labels)
+        return bad();
+
+    // check every index, so that no lookup
+    // on the restored tables can go astray
+    url_blocklist bl;
+    bl.rules_ = static_cast<std::size_t>(rules);
+    bl.nodes_.resize(static_cast<std::size_t>(nodes));
+    for(auto& n : bl.nodes_)
+    {
+        n.parent = get_u32(p);
+        n.label = get_u32(p);
+        n.size = get_u32(p);
+        n.hash = get_u32(p);
+        n.rule = get_u32(p);
+        n.sub = get_u32(p);
+        if( (n.parent != none && n.parent >= nodes) ||
+            std::uint64_t(n.label) + n.size > labels ||
+            (n.rule != none && n.rule >= rules) ||
+            (n.sub != none && n.sub >= nodes))
+            return bad();
+    }
+    if( bl.nodes_[0].parent != none ||
+        bl.nodes_[0].size != 0)
+        return bad();
+    bl.slots_.resize(static_cast<std::size_t>(slots));
+    std::size_t used = 0;
+    for(auto& v : bl.slots_)
+    {
+        v = get_u32(p);
+        if(v > nodes)
+            return bad();
+        if(v != 0)
+            ++used;
+    }
+    if(used >= slots)
+        return bad();
+    bl.labels_.assign(p, static_cast<std::size_t>(labels));
+    return bl;
+}
+
+} // urls
+} // boost
+
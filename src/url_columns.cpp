@@ -0,0 +1,422 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_columns.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/core/bit.hpp>
+#include "detail/normalized_host.hpp"
+#include <algorithm>
+#include <type_traits>
+
+#ifdef BOOST_URL_USE_SSE2
+# include <emmintrin.h>
+#endif
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+#ifdef BOOST_URL_USE_SSE2
+inline
+__m128i
+splat(
+    std::uint16_t v,
+    std::integral_constant<std::size_t, 2>) noexcept
+{
+    return _mm_set1_epi16(static_cast<short>(v));
+}
+
+inline
+__m128i
+splat(
+    std::uint32_t v,
+    std::integral_constant<std::size_t, 4>) noexcept
+{
+    return _mm_set1_epi32(static_cast<int>(v));
+}
+
+inline
+__m128i
+compare(
+    __m128i a,
+    __m128i b,
+    std::integral_constant<std::size_t, 2>) noexcept
+{
+    return _mm_cmpeq_epi16(a, b);
+}
+
+inline
+__m128i
+compare(
+    __m128i a,
+    __m128i b,
+    std::integral_constant<std::size_t, 4>) noexcept
+{
+    return _mm_cmpeq_epi32(a, b);
+}
+#endif
+
+// invoke f with the index of each
+// element of [p, p + n) equal to v
+template<class T, class U, class F>
+void
+for_each_equal(
+    T const* p,
+    std::size_t n,
+    T v,
+    U uv,
+    F const& f)
+{
+    std::size_t i = 0;
+#ifdef BOOST_URL_USE_SSE2
+    static_assert(
+        sizeof(T) == sizeof(U),
+        "U must be the representation of T");
+    using width = std::integral_constant<
+        std::size_t, sizeof(T)>;
+    constexpr std::size_t lanes = 16 / sizeof(T);
+    constexpr unsigned lane_bits =
+        (1u << sizeof(T)) - 1;
+    auto const vv = splat(uv, width());
+    for(; i + lanes <= n; i += lanes)
+    {
+        auto m = static_cast<unsigned>(
+            _mm_movemask_epi8(compare(
+                _mm_loadu_si128(
+                    reinterpret_cast<
+                        __m128i const*>(p + i)),
+                vv, width())));
+        while(m != 0)
+        {
+            auto const b = static_cast<
+                unsigned>(core::countr_zero(m));
+            f(i + b / sizeof(T));
+            m &= ~(lane_bits << b);
+        }
+    }
+#else
+    (void)uv;
+#endif
+    for(; i < n; ++i)
+        if(p[i] == v)
+            f(i);
+}
+
+template<class T>
+void
+grow_one(std::vector<T>& v)
+{
+    if(v.size() < v.capacity())
+        return;
+    v.reserve((std::max)(
+        v.capacity() * 2,
+        std::size_t(16)));
+}
+
+void
+grow_chars(
+    std::string& s,
+    std::size_t n)
+{
+    if(s.capacity() - s.size() >= n)
+        return;
+    s.reserve((std::max)(
+        s.capacity() * 2,
+        s.size() + n));
+}
+
+} // (anon)
+
+//------------------------------------------------
+
+url_columns::
+url_columns()
+{
+    grow_dict();
+    intern({});
+}
+
+pct_string_view
+url_columns::
+get(
+    heap const& h,
+    std::size_t row) noexcept
+{
+    return make_pct_string_view_unsafe(
+        h.s.data() + h.off[row],
+        h.off[row + 1] - h.off[row],
+        h.dn[row]);
+}
+
+void
+url_columns::
+grow_dict()
+{
+    std::size_t const n = dict_slots_.empty() ?
+        16 : dict_slots_.size() * 2;
+    std::vector<std::uint32_t> v(n, 0);
+    for(std::uint32_t id = 0;
+        id < host_count(); ++id)
+    {
+        std::size_t i = detail::hash_normalized_host(
+            host(id)) & (n - 1);
+        while(v[i] != 0)
+            i = (i + 1) & (n - 1);
+        v[i] = id + 1;
+    }
+    dict_slots_ = std::move(v);
+}
+
+// return the id of the host, adding it
+// to the dictionary if necessary. the
+// caller must have reserved space.
+std::uint32_t
+url_columns::
+intern(core::string_view s)
+{
+    std::size_t const mask =
+        dict_slots_.size() - 1;
+    std::size_t i =
+        detail::hash_normalized_host(s) & mask;
+    for(;;)
+    {
+        auto const slot = dict_slots_[i];
+        if(slot == 0)
+            break;
+        if(detail::equal_normalized_host(
+                host(slot - 1), s))
+            return slot - 1;
+        i = (i + 1) & mask;
+    }
+    auto const id = static_cast<
+        std::uint32_t>(host_count());
+    detail::for_each_normalized_host(s,
+        [this](char c)
+        {
+            dict_.push_back(c);
+        });
+    dict_off_.push_back(dict_.size());
+    dict_slots_[i] = id + 1;
+    return id;
+}
+
+boost::optional<std::uint32_t>
+url_columns::
+find_host(core::string_view s) const noexcept
+{
+    std::size_t const mask =
+        dict_slots_.size() - 1;
+    std::size_t i =
+        detail::hash_normalized_host(s) & mask;
+    for(;;)
+    {
+        auto const slot = dict_slots_[i];
+        if(slot == 0)
+            return boost::none;
+        if(detail::equal_normalized_host(
+                host(slot - 1), s))
+            return slot - 1;
+        i = (i + 1) & mask;
+    }
+}
+
+system::result<std::size_t>
+url_columns::
+append(core::string_view s)
+{
+    auto rv = parse_uri_reference(s);
+    if(! rv)
+        return rv.error();
+    return append(*rv);
+}
+
+std::size_t
+url_columns::
+append(url_view_base const& u)
+{
+    auto const host = u.encoded_host();
+    auto const path = u.encoded_path();
+    auto const query = u.encoded_query();
+    auto const frag = u.encoded_fragment();
+
+    // allocate everything first, so
+    // that nothing below can throw
+    grow_one(scheme_);
+    grow_one(host_type_);
+    grow_one(host_);
+    grow_one(port_);
+    grow_one(flags_);
+    for(auto* h : { &path_, &query_, &frag_ })
+    {
+        grow_one(h->off);
+        grow_one(h->dn);
+    }
+    grow_chars(path_.s, path.size());
+    grow_chars(query_.s, query.size());
+    grow_chars(frag_.s, frag.size());
+    if((host_count() + 1) * 2 > dict_slots_.size())
+        grow_dict();
+    grow_one(dict_off_);
+    grow_chars(dict_,
+        detail::normalized_host_size(host));
+
+    auto const row = size();
+    scheme_.push_back(u.scheme_id());
+    host_type_.push_back(u.host_type());
+    host_.push_back(intern(host));
+    port_.push_back(u.port_number());
+    flags_.push_back(static_cast<unsigned char>(
+        (u.has_query() ? 1 : 0) |
+        (u.has_fragment() ? 2 : 0)));
+    auto const put = [](
+        heap& h, pct_string_view s)
+    {
+        h.s.append(s.data(), s.size());
+        h.off.push_back(h.s.size());
+        h.dn.push_back(s.decoded_size());
+    };
+    put(path_, path);
+    put(query_, query);
+    put(frag_, frag);
+    return row;
+}
+
+void
+url_columns::
+reserve(std::size_t n)
+{
+    scheme_.reserve(n);
+    host_type_.reserve(n);
+    host_.reserve(n);
+    port_.reserve(n);
+    flags_.reserve(n);
+    for(auto* h : { &path_, &query_, &frag_ })
+    {
+        h->off.reserve(n + 1);
+        h->dn.reserve(n);
+    }
+}
+
+void
+url_columns::
+clear() noexcept
+{
+    scheme_.clear();
+    host_type_.clear();
+    host_.clear();
+    port_.clear();
+    flags_.clear();
+    for(auto* h : { &path_, &query_, &frag_ })
+    {
+        h->s.clear();
+        h->off.resize(1);
+        h->dn.clear();
+    }
+    dict_.clear();
+    dict_off_.resize(1);
+    std::fill(
+        dict_slots_.begin(),
+        dict_slots_.end(), 0);
+    // cannot throw, the slots and
+    // offsets are already allocated
+    intern({});
+}
+
+//------------------------------------------------
+
+std::size_t
+url_columns::
+count(scheme id) const noexcept
+{
+    std::size_t n = 0;
+    for_each_equal(
+        scheme_.data(), scheme_.size(), id,
+        static_cast<std::uint16_t>(id),
+        [&n](std::size_t)
+        {
+            ++n;
+        });
+    return n;
+}
+
+void
+url_columns::
+select(
+    scheme id,
+    std::vector<std::size_t>& rows) const
+{
+    for_each_equal(
+        scheme_.data(), scheme_.size(), id,
+        static_cast<std::uint16_t>(id),
+        [&rows](std::size_t i)
+        {
+            rows.push_back(i);
+        });
+}
+
+void
+url_columns::
+select_host(
+    core::string_view s,
+    std::vector<std::size_t>& rows) const
+{
+    auto const id = find_host(s);
+    if(! id)
+        return;
+    for_each_equal(
+        host_.data(), host_.size(), *id, *id,
+        [&rows](std::size_t i)
+        {
+            rows.push_back(i);
+        });
+}
+
+void
+url_columns::
+select_port(
+    std::uint16_t port,
+    std::vector<std::size_t>& rows) const
+{
+    for_each_equal(
+        port_.data(), port_.size(), port, port,
+        [&rows](std::size_t i)
+        {
+            rows.push_back(i);
+        });
+}
+
+std::vector<std::size_t>
+url_columns::
+count_by_scheme() const
+{
+    std::vector<std::size_t> v(
+        static_cast<std::size_t>(
+            scheme::wss) + 1, 0);
+    for(auto id : scheme_)
+        ++v[static_cast<std::size_t>(id)];
+    return v;
+}
+
+std::vector<std::size_t>
+url_columns::
+count_by_host() const
+{
+    std::vector<std::size_t> v(
+        host_count(), 0);
+    for(auto id : host_)
+        ++v[id];
+    return v;
+}
+
+} // urls
+} // boost
+
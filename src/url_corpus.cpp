@@ -0,0 +1,187 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_corpus.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/detail/except.hpp>
+#include <cstring>
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <atomic>
+# include <exception>
+# include <functional>
+# include <thread>
+#endif
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+void
+parse_chunk(
+    url_corpus::chunk& c)
+{
+    char const* it = c.text.data();
+    char const* const end =
+        it + c.text.size();
+    std::size_t line = 0;
+    while(it != end)
+    {
+        auto nl = static_cast<char const*>(
+            std::memchr(it, '\n', end - it));
+        char const* next;
+        if(nl)
+            next = nl + 1;
+        else
+            nl = next = end;
+        if( nl != it &&
+            nl[-1] == '\r')
+            --nl;
+        if(nl != it)
+        {
+            auto rv = parse_uri_reference(
+                core::string_view(it, nl - it));
+            if(rv)
+            {
+                c.urls.push_back(*rv);
+            }
+            else
+            {
+                if(c.errors++ == 0)
+                {
+                    c.first_error = rv.error();
+                    c.first_error_line = line;
+                }
+            }
+        }
+        ++line;
+        it = next;
+    }
+    c.lines = line;
+}
+
+} // (anon)
+
+url_corpus::
+url_corpus(
+    core::string_view s)
+    : url_corpus(s, options())
+{
+}
+
+url_corpus::
+url_corpus(
+    core::string_view s,
+    options const& opt)
+{
+    if(opt.chunk_size == 0)
+        detail::throw_invalid_argument();
+
+    // split into chunks ending just
+    // after a newline, or at the end
+    char const* it = s.data();
+    char const* const end =
+        it + s.size();
+    while(it != end)
+    {
+        char const* last;
+        if(static_cast<std::size_t>(
+            end - it) <= opt.chunk_size)
+        {
+            last = end;
+        }
+        else
+        {
+            auto const p = it + opt.chunk_size - 1;
+            last = static_cast<char const*>(
+                std::memchr(p, '\n', end - p));
+            last = last ? last + 1 : end;
+        }
+        v_.emplace_back();
+        v_.back().text = core::string_view(
+            it, last - it);
+        it = last;
+    }
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    std::size_t n = opt.threads;
+    if(n == 0)
+        n = std::thread::hardware_concurrency();
+    if(n > v_.size())
+        n = v_.size();
+    if(n > 1)
+    {
+        // each thread takes the next
+        // chunk until none remain
+        std::atomic<std::size_t> next{0};
+        std::vector<std::exception_ptr> ep(n);
+        auto const work =
+            [this, &next](std::exception_ptr& e)
+            {
+                try
+                {
+                    for(;;)
+                    {
+                        auto const i = next.fetch_add(
+                            1, std::memory_order_relaxed);
+                        if(i >= v_.size())
+                            break;
+                        parse_chunk(v_[i]);
+                    }
+                }
+                catch(...)
+                {
+                    e = std::current_exception();
+                    next.store(v_.size(),
+                        std::memory_order_relaxed);
+                }
+            };
+        std::vector<std::thread> threads;
+        threads.reserve(n - 1);
+        try
+        {
+            for(std::size_t i = 1; i < n; ++i)
+                threads.emplace_back(
+                    work, std::ref(ep[i]));
+        }
+        catch(std::exception const&)
+        {
+            // run with the threads
+            // which were started
+        }
+        work(ep[0]);
+        for(auto& t : threads)
+            t.join();
+        for(auto const& e : ep)
+            if(e)
+                std::rethrow_exception(e);
+    }
+    else
+#endif
+    {
+        for(auto& c : v_)
+            parse_chunk(c);
+    }
+
+    for(auto& c : v_)
+    {
+        c.first_line = lines_;
+        c.first_error_line += lines_;
+        lines_ += c.lines;
+        size_ += c.urls.size();
+        errors_ += c.errors;
+    }
+}
+
+} // urls
+} // boost
+
@@ -0,0 +1,62 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_hash.hpp>
+#include <boost/url/parse.hpp>
+#include "detail/normalize.hpp"
+
+namespace boost {
+namespace urls {
+
+std::size_t
+url_hash::
+operator()(
+    core::string_view s) const noexcept
+{
+    auto rv = parse_uri_reference(s);
+    if(rv)
+        return (*this)(*rv);
+    // not a url, so only
+    // equal to itself
+    detail::fnv_1a h(salt_);
+    h.put(s);
+    return h.digest();
+}
+
+//------------------------------------------------
+
+bool
+url_equal::
+operator()(
+    url_view_base const& u0,
+    core::string_view s1) const noexcept
+{
+    auto rv = parse_uri_reference(s1);
+    return rv && u0 == *rv;
+}
+
+bool
+url_equal::
+operator()(
+    core::string_view s0,
+    core::string_view s1) const noexcept
+{
+    auto rv0 = parse_uri_reference(s0);
+    auto rv1 = parse_uri_reference(s1);
+    if(rv0 && rv1)
+        return *rv0 == *rv1;
+    if(rv0 || rv1)
+        return false;
+    return s0 == s1;
+}
+
+} // urls
+} // boost
@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_pattern.hpp>
+#include <memory>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// words of state kept on the stack
+// while matching a single pattern
+constexpr std::size_t stack_words = 16;
+
+} // (anon)
+
+url_pattern::
+url_pattern()
+{
+    for(auto& s : s_)
+        s = "**";
+}
+
+core::string_view
+url_pattern::
+part(
+    url_view_base const& u,
+    int id) noexcept
+{
+    switch(id)
+    {
+    case id_protocol:
+        return u.scheme();
+    case id_hostname:
+        return u.encoded_host();
+    case id_pathname:
+        return u.encoded_path();
+    case id_search:
+        return u.encoded_query();
+    default:
+    case id_hash:
+        return u.encoded_fragment();
+    }
+}
+
+void
+url_pattern::
+set(int id, core::string_view s)
+{
+    std::string s1(s);
+    detail::glob_nfa nfa;
+    if(! is_any(s))
+        nfa.build(&s, 1,
+            id == id_protocol ||
+            id == id_hostname);
+    s_[id] = std::move(s1);
+    nfa_[id] = std::move(nfa);
+}
+
+bool
+url_pattern::
+match(url_view_base const& u) const
+{
+    std::size_t words = 0;
+    for(auto const& nfa : nfa_)
+        if(words < nfa.words())
+            words = nfa.words();
+    std::uint64_t small[2 * stack_words];
+    std::unique_ptr<std::uint64_t[]> big;
+    std::uint64_t* buf = small;
+    if(words > stack_words)
+    {
+        big.reset(new std::uint64_t[2 * words]);
+        buf = big.get();
+    }
+    for(int id = 0; id < id_end; ++id)
+    {
+        auto const& nfa = nfa_[id];
+        if(nfa.size() == 0)
+            continue;
+        auto const states =
+            nfa.run(part(u, id), buf);
+        if( ! states ||
+            ! nfa.accepted(states, 0))
+            return false;
+    }
+    return true;
+}
+
+} // urls
+} // boost
+
@@ -0,0 +1,120 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_pattern_set.hpp>
+#include <boost/core/bit.hpp>
+#include <algorithm>
+
+namespace boost {
+namespace urls {
+
+void
+url_pattern_set::
+build()
+{
+    using P = url_pattern;
+    detail::glob_nfa nfa[P::id_end];
+    std::vector<std::size_t> ids[P::id_end];
+    std::vector<core::string_view> pats;
+    for(int id = 0; id < P::id_end; ++id)
+    {
+        pats.clear();
+        for(std::size_t i = 0; i < v_.size(); ++i)
+        {
+            core::string_view s = v_[i].s_[id];
+            if(P::is_any(s))
+                continue;
+            pats.push_back(s);
+            ids[id].push_back(i);
+        }
+        // the patterns were checked when
+        // they were set on the url_pattern
+        nfa[id].build(
+            pats.data(), pats.size(),
+            id == P::id_protocol ||
+            id == P::id_hostname);
+    }
+    for(int id = 0; id < P::id_end; ++id)
+    {
+        nfa_[id] = std::move(nfa[id]);
+        ids_[id] = std::move(ids[id]);
+    }
+}
+
+std::size_t
+url_pattern_set::
+add(url_pattern const& p)
+{
+    return add(&p, &p + 1);
+}
+
+void
+url_pattern_set::
+match(
+    url_view_base const& u,
+    std::vector<std::size_t>& ids) const
+{
+    using P = url_pattern;
+    if(v_.empty())
+        return;
+
+    // the rules still matching
+    std::size_t const nw = (v_.size() + 63) / 64;
+    std::vector<std::uint64_t> live(nw, ~std::uint64_t(0));
+    if(v_.size() % 64 != 0)
+        live[nw - 1] = (std::uint64_t(1) <<
+            (v_.size() % 64)) - 1;
+    auto const clear = [&live](std::size_t i)
+    {
+        live[i / 64] &= ~(std::uint64_t(1) << (i % 64));
+    };
+
+    std::size_t words = 0;
+    for(auto const& nfa : nfa_)
+        if(words < nfa.words())
+            words = nfa.words();
+    std::vector<std::uint64_t> buf(2 * words);
+    for(int id = 0; id < P::id_end; ++id)
+    {
+        auto const& nfa = nfa_[id];
+        if(nfa.size() == 0)
+            continue;
+        auto const states = nfa.run(
+            P::part(u, id), buf.data());
+        auto const& rule = ids_[id];
+        for(std::size_t i = 0; i < rule.size(); ++i)
+            if( ! states ||
+                ! nfa.accepted(states, i))
+                clear(rule[i]);
+        if(std::all_of(
+                live.begin(), live.end(),
+                [](std::uint64_t w)
+                {
+                    return w == 0;
+                }))
+            return;
+    }
+
+    for(std::size_t w = 0; w < nw; ++w)
+    {
+        auto m = live[w];
+        while(m != 0)
+        {
+            ids.push_back(w * 64 +
+                core::countr_zero(m));
+            m &= m - 1;
+        }
+    }
+}
+
+} // urls
+} // boost
+
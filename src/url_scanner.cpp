@@ -0,0 +1,426 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_scanner.hpp>
+#include <boost/url/grammar/alpha_chars.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/grammar/digit_chars.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/rfc/gen_delim_chars.hpp>
+#include <boost/url/rfc/relative_ref_rule.hpp>
+#include <boost/url/rfc/sub_delim_chars.hpp>
+#include <boost/url/rfc/unreserved_chars.hpp>
+#include <boost/url/rfc/uri_rule.hpp>
+#include <boost/core/bit.hpp>
+
+#ifdef BOOST_URL_USE_SSE2
+# include <emmintrin.h>
+#endif
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// characters which may appear in a url
+constexpr grammar::lut_chars url_chars =
+    unreserved_chars +
+    gen_delim_chars +
+    sub_delim_chars +
+    grammar::lut_chars('%');
+
+constexpr grammar::lut_chars scheme_chars =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    "abcdefghijklmnopqrstuvwxyz"
+    "0123456789"
+    "+-.";
+
+constexpr grammar::lut_chars alnum_chars =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    "abcdefghijklmnopqrstuvwxyz"
+    "0123456789";
+
+// characters which may not precede "www."
+// for it to begin a host name
+constexpr grammar::lut_chars word_chars =
+    alnum_chars +
+    grammar::lut_chars("-._~/@:%+&=#?$*");
+
+// return the first ':' or '.' in
+// the range, which are the characters
+// ending "http:" and beginning ".com"
+char const*
+find_trigger(
+    char const* it,
+    char const* end) noexcept
+{
+#ifdef BOOST_URL_USE_SSE2
+    auto const colon = _mm_set1_epi8(':');
+    auto const dot = _mm_set1_epi8('.');
+    while(end - it >= 16)
+    {
+        auto const v = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(it));
+        unsigned const m = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_or_si128(
+                _mm_cmpeq_epi8(v, colon),
+                _mm_cmpeq_epi8(v, dot))));
+        if(m != 0)
+            return it + core::countr_zero(m);
+        it += 16;
+    }
+#endif
+    while(it != end)
+    {
+        if( *it == ':' ||
+            *it == '.')
+            break;
+        ++it;
+    }
+    return it;
+}
+
+// remove punctuation which more likely
+// belongs to the surrounding text
+char const*
+trim_end(
+    char const* first,
+    char const* last) noexcept
+{
+    // the balance of parentheses
+    // and brackets in the range
+    std::ptrdiff_t parens = 0;
+    std::ptrdiff_t brackets = 0;
+    for(auto p = first; p != last; ++p)
+    {
+        switch(*p)
+        {
+        case '(': ++parens; break;
+        case ')': --parens; break;
+        case '[': ++brackets; break;
+        case ']': --brackets; break;
+        default:
+            break;
+        }
+    }
+    while(last != first)
+    {
+        switch(last[-1])
+        {
+        case '.': case ',': case ':':
+        case ';': case '!': case '?':
+        case '\'': case '*':
+            --last;
+            continue;
+
+        // keep a closing bracket
+        // only if it is balanced
+        case ')':
+            if(parens < 0)
+            {
+                ++parens;
+                --last;
+                continue;
+            }
+            break;
+
+        case ']':
+            if(brackets < 0)
+            {
+                ++brackets;
+                --last;
+                continue;
+            }
+            break;
+
+        default:
+            break;
+        }
+        break;
+    }
+    return last;
+}
+
+// return the end of the span which
+// may hold a url beginning at `first`
+char const*
+span_end(
+    char const* first,
+    char const* end,
+    char closer) noexcept
+{
+    auto it = first;
+    while( it != end &&
+        url_chars(*it) &&
+        *it != closer)
+    {
+        // a malformed escape ends the span
+        if( *it == '%' && (
+            end - it < 3 ||
+            ! grammar::hexdig_chars(it[1]) ||
+            ! grammar::hexdig_chars(it[2])))
+            break;
+        ++it;
+    }
+    return it;
+}
+
+// return the delimiter which ends a url
+// beginning at `first`, or zero
+char
+closer_of(
+    char const* begin,
+    char const* first) noexcept
+{
+    if(first == begin)
+        return 0;
+    switch(first[-1])
+    {
+    case '<': return '>';
+    case '"': return '"';
+    case '\'': return '\'';
+    default:
+        break;
+    }
+    return 0;
+}
+
+// return the url beginning at `first`,
+// in the span ending at `last`. Unless
+// the span is delimited, the url ends
+// before trailing punctuation.
+template<class Rule>
+boost::optional<url_view>
+match(
+    char const* first,
+    char const* last,
+    bool delimited,
+    Rule const& r) noexcept
+{
+    // the text is trimmed after parsing,
+    // so that only the characters of the
+    // url are examined
+    auto it = first;
+    auto rv = grammar::parse(it, last, r);
+    if(! rv)
+        return boost::none;
+    if( it != last ||
+        ! delimited)
+    {
+        auto const last1 = trim_end(first, it);
+        if(last1 != it)
+        {
+            rv = grammar::parse(
+                core::string_view(
+                    first, last1 - first), r);
+            if(! rv)
+                return boost::none;
+        }
+    }
+    return *rv;
+}
+
+// return the end of the text of a url
+// beginning at `first`, whose host ends
+// at the ':' at `it`, in the span ending
+// at `last`. The port, and the path-abempty,
+// query, and fragment after it, cannot be
+// held in a relative-ref.
+char const*
+skip_port(
+    char const* first,
+    char const* it,
+    char const* last,
+    bool delimited) noexcept
+{
+    auto p = it + 1;
+    while( p != last &&
+        grammar::digit_chars(*p))
+        ++p;
+    if(p == it + 1)
+        return it;
+    if( p != last && (
+        *p == '/' ||
+        *p == '?' ||
+        *p == '#'))
+    {
+        // the longest valid prefix
+        auto p1 = p;
+        if(grammar::parse(
+                p1, last, relative_ref_rule))
+            p = p1;
+    }
+    if( p != last ||
+        ! delimited)
+    {
+        // the digits of the port
+        // are never trimmed
+        p = trim_end(first, p);
+    }
+    return p;
+}
+
+} // (anon)
+
+// return the end of the span which
+// may hold a url beginning at `first`,
+// in the text ending at `end`
+char const*
+url_scanner::
+find_span(
+    char const* first,
+    char const* end,
+    bool& delimited) noexcept
+{
+    char const closer =
+        closer_of(first_, first);
+    char const* last;
+    if( end != end_ ||
+        closer == '\'')
+    {
+        // '\'' is the only closer which
+        // may appear in a url, and ends
+        // spans which do not overlap
+        last = span_end(
+            first, end, closer);
+    }
+    else
+    {
+        // a span ends at the same place for
+        // every url beginning within it, so
+        // that it is only searched once
+        if( first < span_first_ ||
+            first >= span_last_)
+        {
+            span_first_ = first;
+            span_last_ = span_end(
+                first, end_, 0);
+        }
+        last = span_last_;
+    }
+    delimited =
+        closer != 0 &&
+        last != end &&
+        *last == closer;
+    return last;
+}
+
+boost::optional<url_view>
+url_scanner::
+next() noexcept
+{
+    char const* lo = it_;
+    auto p = it_;
+    for(;;)
+    {
+        p = find_trigger(p, end_);
+        if(p == end_)
+        {
+            it_ = end_;
+            return boost::none;
+        }
+        boost::optional<url_view> rv;
+        if(*p == ':')
+        {
+            if( end_ - p >= 3 &&
+                p[1] == '/' &&
+                p[2] == '/')
+            {
+                // scheme "://"
+                auto s = p;
+                while( s != lo &&
+                    scheme_chars(s[-1]))
+                    --s;
+                while( s != p &&
+                    ! grammar::alpha_chars(*s))
+                    ++s;
+                if(s != p)
+                {
+                    bool delimited;
+                    auto const last = find_span(
+                        s, end_, delimited);
+                    rv = match(s, last,
+                        delimited, uri_rule);
+                    if(rv)
+                    {
+                        auto const next =
+                            rv->buffer().data() +
+                            rv->buffer().size();
+                        if( ! rv->encoded_host().empty() ||
+                            rv->scheme_id() == scheme::file)
+                        {
+                            it_ = next;
+                            return rv;
+                        }
+
+                        // the text of a url without
+                        // a host is not searched
+                        // again, so that the time
+                        // stays linear
+                        p = next;
+                        lo = next;
+                        continue;
+                    }
+                }
+            }
+        }
+        else if(
+            p - lo >= 3 &&
+            end_ - p >= 2 &&
+            alnum_chars(p[1]) &&
+            grammar::ci_is_equal(
+                core::string_view(p - 3, 3), "www") &&
+            ( p - 3 == first_ ||
+                ! word_chars(p[-4])))
+        {
+            // "www.", where a port cannot
+            // follow the host of a relative-ref.
+            // The text of the url still ends
+            // after the port and the path.
+            auto e = p;
+            while( e != end_ &&
+                url_chars(*e) &&
+                *e != ':' &&
+                *e != '/' &&
+                *e != '?' &&
+                *e != '#')
+                ++e;
+            if(e == end_ || *e != ':')
+                e = end_;
+            bool delimited;
+            auto last = find_span(
+                p - 3, e, delimited);
+            rv = match(p - 3, last,
+                delimited, relative_ref_rule);
+            if( rv &&
+                rv->buffer().size() > 4)
+            {
+                it_ = rv->buffer().data() +
+                    rv->buffer().size();
+                if(it_ == e)
+                {
+                    last = find_span(
+                        p - 3, end_, delimited);
+                    it_ = skip_port(p - 3,
+                        e, last, delimited);
+                }
+                return rv;
+            }
+        }
+        ++p;
+    }
+}
+
+} // urls
+} // boost
+
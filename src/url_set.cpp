@@ -0,0 +1,343 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_set.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/assert.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+/*  Entry layout, integers are LEB128
+
+    N   number of characters shared with
+        the previous url, zero for the first
+        url in a block
+    N   number of remaining characters
+    N   remaining characters
+    1   one if the fields below follow, or
+        zero if they are the same as for the
+        previous url in the block
+
+    N   len( id ) for each part
+    N   len( id ) - decoded_[ id ] for each
+        part after the scheme
+    N   nseg
+    N   nparam
+    1   host_type | ( scheme << 3 )
+    N   port_number
+    N   ip_addr, 4 for ipv4, 16 for ipv6, else 0
+*/
+
+void
+put_varint(
+    std::string& s,
+    std::size_t v)
+{
+    while(v >= 0x80)
+    {
+        s.push_back(static_cast<char>(
+            (v & 0x7f) | 0x80));
+        v >>= 7;
+    }
+    s.push_back(static_cast<char>(v));
+}
+
+std::size_t
+get_varint(
+    char const*& p) noexcept
+{
+    std::size_t v = 0;
+    int shift = 0;
+    for(;;)
+    {
+        auto const b = static_cast<
+            unsigned char>(*p++);
+        v |= static_cast<std::size_t>(
+            b & 0x7f) << shift;
+        if(b < 0x80)
+            return v;
+        shift += 7;
+    }
+}
+
+std::size_t
+addr_size(host_type ht) noexcept
+{
+    switch(ht)
+    {
+    case host_type::ipv4:
+        return 4;
+    case host_type::ipv6:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+// return the characters of the first
+// url in the block beginning at `p`
+core::string_view
+block_key(char const* p) noexcept
+{
+    auto const shared = get_varint(p);
+    BOOST_ASSERT(shared == 0);
+    (void)shared;
+    auto const n = get_varint(p);
+    return core::string_view(p, n);
+}
+
+} // (anon)
+
+constexpr std::size_t url_set::block_size;
+
+//------------------------------------------------
+
+void
+url_set::
+iterator::
+read()
+{
+    auto const& data = set_->data_;
+    if(pos_ == data.size())
+        return;
+    using P = detail::parts_base;
+    char const* p = data.data() + pos_;
+    auto const shared = get_varint(p);
+    auto const n = get_varint(p);
+    BOOST_ASSERT(shared <= buf_.size());
+    buf_.resize(shared);
+    buf_.append(p, n);
+    p += n;
+    if(*p++ == 0)
+    {
+        next_ = p - data.data();
+        return;
+    }
+    std::size_t off = 0;
+    for(int id = P::id_scheme; id < P::id_end; ++id)
+    {
+        off += get_varint(p);
+        impl_.offset_[id + 1] = off;
+    }
+    BOOST_ASSERT(
+        impl_.offset_[P::id_end] == buf_.size());
+    for(int id = 0; id < P::id_end; ++id)
+        impl_.decoded_[id] =
+            impl_.len(id) - get_varint(p);
+    impl_.nseg_ = get_varint(p);
+    impl_.nparam_ = get_varint(p);
+    auto const b = static_cast<
+        unsigned char>(*p++);
+    impl_.host_type_ = static_cast<
+        host_type>(b & 7);
+    impl_.scheme_ = static_cast<
+        scheme>(b >> 3);
+    impl_.port_number_ = static_cast<
+        std::uint16_t>(get_varint(p));
+    auto const na = addr_size(impl_.host_type_);
+    std::memcpy(impl_.ip_addr_, p, na);
+    p += na;
+    next_ = p - data.data();
+}
+
+auto
+url_set::
+iterator::
+operator*() const noexcept ->
+    reference
+{
+    auto impl = impl_;
+    impl.cs_ = buf_.data();
+    return impl.construct();
+}
+
+//------------------------------------------------
+
+void
+url_set::
+append(url_view_base const& u)
+{
+    using P = detail::parts_base;
+    core::string_view const s = u.buffer();
+    if( size_ != 0 &&
+        ! (core::string_view(prev_) < s))
+        detail::throw_invalid_argument();
+    std::size_t shared = 0;
+    if(size_ % block_size == 0)
+    {
+        index_.push_back(data_.size());
+    }
+    else
+    {
+        auto const n = (std::min)(
+            prev_.size(), s.size());
+        while( shared < n &&
+            prev_[shared] == s[shared])
+            ++shared;
+    }
+    put_varint(data_, shared);
+    put_varint(data_, s.size() - shared);
+    data_.append(
+        s.data() + shared, s.size() - shared);
+    auto const& impl = *u.pi_;
+    std::string meta;
+    for(int id = P::id_scheme; id < P::id_end; ++id)
+        put_varint(meta, impl.len(id));
+    for(int id = 0; id < P::id_end; ++id)
+        put_varint(meta,
+            impl.len(id) - impl.decoded_[id]);
+    put_varint(meta, impl.nseg_);
+    put_varint(meta, impl.nparam_);
+    meta.push_back(static_cast<char>(
+        static_cast<unsigned>(impl.host_type_) |
+        (static_cast<unsigned>(impl.scheme_) << 3)));
+    put_varint(meta, impl.port_number_);
+    meta.append(
+        reinterpret_cast<char const*>(impl.ip_addr_),
+        addr_size(impl.host_type_));
+    // urls differing only in the characters
+    // of a part, such as the same path with
+    // another number, share their fields
+    if( size_ % block_size != 0 &&
+        meta == prev_meta_)
+    {
+        data_.push_back(0);
+    }
+    else
+    {
+        data_.push_back(1);
+        data_.append(meta);
+        prev_meta_ = std::move(meta);
+    }
+    prev_.assign(s.data(), s.size());
+    ++size_;
+}
+
+void
+url_set::
+finish()
+{
+    prev_.clear();
+    prev_.shrink_to_fit();
+    prev_meta_.clear();
+    prev_meta_.shrink_to_fit();
+    data_.shrink_to_fit();
+    index_.shrink_to_fit();
+}
+
+// return the last block whose first
+// url is not greater than s, or
+// index_.size() if there is none
+std::size_t
+url_set::
+find_block(
+    core::string_view s) const noexcept
+{
+    std::size_t lo = 0;
+    std::size_t hi = index_.size();
+    while(lo < hi)
+    {
+        auto const mid = lo + (hi - lo) / 2;
+        if(s < block_key(
+                data_.data() + index_[mid]))
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    if(lo == 0)
+        return index_.size();
+    return lo - 1;
+}
+
+auto
+url_set::
+begin() const ->
+    iterator
+{
+    return iterator(*this, 0);
+}
+
+auto
+url_set::
+end() const noexcept ->
+    iterator
+{
+    iterator it;
+    it.set_ = this;
+    it.pos_ = data_.size();
+    return it;
+}
+
+std::size_t
+url_set::
+memory_usage() const noexcept
+{
+    return data_.capacity() +
+        index_.capacity() *
+            sizeof(std::size_t);
+}
+
+bool
+url_set::
+contains(core::string_view s) const
+{
+    auto const it = lower_bound(s);
+    return
+        it.pos_ != data_.size() &&
+        core::string_view(it.buf_) == s;
+}
+
+auto
+url_set::
+lower_bound(core::string_view s) const ->
+    iterator
+{
+    auto const b = find_block(s);
+    if(b == index_.size())
+        return begin();
+    iterator it(*this, index_[b]);
+    auto const last =
+        b + 1 < index_.size() ?
+            index_[b + 1] : data_.size();
+    while( it.pos_ != last &&
+        core::string_view(it.buf_) < s)
+        ++it;
+    return it;
+}
+
+auto
+url_set::
+prefix_range(core::string_view prefix) const ->
+    std::pair<iterator, iterator>
+{
+    // the range ends at the first url not
+    // less than the smallest string greater
+    // than every string with the prefix
+    std::string t(prefix.data(), prefix.size());
+    while( ! t.empty() &&
+        static_cast<unsigned char>(
+            t.back()) == 0xff)
+        t.pop_back();
+    if(t.empty())
+        return { lower_bound(prefix), end() };
+    t.back() = static_cast<char>(
+        static_cast<unsigned char>(
+            t.back()) + 1);
+    return { lower_bound(prefix), lower_bound(t) };
+}
+
+} // urls
+} // boost
+
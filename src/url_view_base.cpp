@@ -13,6 +13,7 @@
 #include <boost/url/url_view_base.hpp>
 #include <boost/url/url_view.hpp>
 #include <boost/url/detail/except.hpp>
+#include "detail/ipv6_text.hpp"
 #include "detail/normalize.hpp"
 #include "detail/over_allocator.hpp"
 
@@ -46,10 +47,14 @@ digest(std::size_t salt) const noexcept
     detail::ci_digest(pi_->get(id_scheme), h);
     detail::digest_encoded(pi_->get(id_user), h);
     detail::digest_encoded(pi_->get(id_pass), h);
-    detail::ci_digest_encoded(pi_->get(id_host), h);
+    char buf[detail::normalized_host_max];
+    detail::ci_digest_encoded(
+        detail::normalized_host(
+            pi_->get(id_host), host_type(),
+            host_ipv6_address(), buf), h);
     h.put(pi_->get(id_port));
     detail::normalized_path_digest(
-        pi_->get(id_path), is_path_absolute(), h);
+        encoded_segments(), h);
     detail::digest_encoded(pi_->get(id_query), h);
     detail::digest_encoded(pi_->get(id_frag), h);
     return h.digest();
@@ -73,8 +78,14 @@ struct url_view_base::shared_impl
         url_view const& u) noexcept
         : url_view(u)
     {
+        // a view of a url references the
+        // url's offsets, which do not
+        // outlive the temporary view.
+        impl_ = *u.pi_;
+        impl_.from_ = from::string;
         impl_.cs_ = reinterpret_cast<
             char const*>(this + 1);
+        pi_ = &impl_;
     }
 };
 
@@ -0,0 +1,196 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/alloc_stats.hpp>
+
+#include <boost/url/small_url.hpp>
+#include <boost/url/static_url.hpp>
+#include <boost/url/url.hpp>
+#include <sstream>
+#include <utility>
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct alloc_stats_test
+{
+    static
+    bool
+    is_zero(alloc_stats const& st) noexcept
+    {
+        return
+            st.allocations == 0 &&
+            st.reallocations == 0 &&
+            st.bytes == 0 &&
+            st.copied == 0 &&
+            st.moved == 0 &&
+            st.peak_capacity == 0;
+    }
+
+    void
+    testUrl()
+    {
+        url u;
+        BOOST_TEST(is_zero(u.stats()));
+
+        u.reserve(10);
+        u.set_encoded_path("/abcdefghijklmnop");
+        BOOST_TEST_EQ(u.buffer(), "/abcdefghijklmnop");
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+        {
+            auto const st = u.stats();
+            BOOST_TEST_EQ(st.allocations, 2u);
+            BOOST_TEST_EQ(st.reallocations, 1u);
+            // 10 + 1, then 17 + 1
+            BOOST_TEST_EQ(st.bytes, 29u);
+            // the null terminator of the empty url
+            BOOST_TEST_EQ(st.copied, 1u);
+            BOOST_TEST_EQ(st.peak_capacity, 17u);
+            BOOST_TEST_EQ(u.capacity(), 17u);
+        }
+
+        // the path moves right
+        {
+            auto const moved = u.stats().moved;
+            u.reserve(100);
+            u.set_scheme("http");
+            BOOST_TEST_EQ(u.buffer(), "http:/abcdefghijklmnop");
+            BOOST_TEST_GE(u.stats().moved, moved + 17);
+            BOOST_TEST_EQ(u.stats().allocations, 3u);
+            BOOST_TEST_EQ(u.stats().copied, 19u);
+            BOOST_TEST_EQ(u.stats().peak_capacity, 100u);
+        }
+
+        // the counters follow the buffer
+        {
+            auto const st = u.stats();
+            url v(std::move(u));
+            BOOST_TEST(is_zero(u.stats()));
+            BOOST_TEST_EQ(v.stats().allocations, st.allocations);
+            BOOST_TEST_EQ(v.stats().moved, st.moved);
+
+            url w;
+            w = std::move(v);
+            BOOST_TEST(is_zero(v.stats()));
+            BOOST_TEST_EQ(w.stats().bytes, st.bytes);
+
+            w.swap(v);
+            BOOST_TEST(is_zero(w.stats()));
+            BOOST_TEST_EQ(v.stats().peak_capacity, 100u);
+
+            // a copy has its own counters
+            url x(v);
+            BOOST_TEST_EQ(x.stats().allocations, 1u);
+            BOOST_TEST_EQ(x.stats().reallocations, 0u);
+        }
+#else
+        BOOST_TEST(is_zero(u.stats()));
+#endif
+    }
+
+    void
+    testSmallUrl()
+    {
+        small_url<16> u("http://a");
+        BOOST_TEST(is_zero(u.stats()));
+        u.set_encoded_path("/abcdefghijklmnop");
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+        BOOST_TEST_EQ(u.stats().allocations, 1u);
+        BOOST_TEST_EQ(u.stats().reallocations, 1u);
+        BOOST_TEST_EQ(u.stats().copied, 9u);
+        BOOST_TEST_GE(u.stats().peak_capacity, 25u);
+#else
+        BOOST_TEST(is_zero(u.stats()));
+#endif
+    }
+
+    void
+    testStaticUrl()
+    {
+        static_url<64> u("http://a/b");
+        u.set_scheme("https");
+        BOOST_TEST_EQ(u.buffer(), "https://a/b");
+        BOOST_TEST_EQ(u.stats().allocations, 0u);
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+        BOOST_TEST_GE(u.stats().moved, 5u);
+#else
+        BOOST_TEST_EQ(u.stats().moved, 0u);
+#endif
+    }
+
+    void
+    testGlobal()
+    {
+        alloc_stats_reset();
+        BOOST_TEST(is_zero(alloc_stats_snapshot()));
+        {
+            url u("http://example.com");
+            u.set_encoded_path("/path/to/a/file/with/a/long/name.txt");
+        }
+        auto const st = alloc_stats_snapshot();
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+        BOOST_TEST_EQ(st.allocations, 2u);
+        BOOST_TEST_EQ(st.reallocations, 1u);
+        BOOST_TEST_EQ(st.copied, 19u);
+        BOOST_TEST_GE(st.peak_capacity, 54u);
+        BOOST_TEST_GT(st.bytes, 54u);
+
+        alloc_stats_reset();
+        BOOST_TEST(is_zero(alloc_stats_snapshot()));
+#else
+        BOOST_TEST(is_zero(st));
+#endif
+    }
+
+    void
+    testJavadocs()
+    {
+        // alloc_stats_snapshot
+        {
+        std::stringstream out;
+        url u( "https://www.example.com" );
+        u.set_path( "/path/to/file.txt" );
+        alloc_stats st = alloc_stats_snapshot();
+        out << st.allocations << " allocations, " << st.copied << " characters copied\n";
+        }
+
+        // url_base::stats
+        {
+        std::stringstream out;
+        url u( "https://www.example.com" );
+        u.set_path( "/path/to/file.txt" );
+        out << u.stats().reallocations << " reallocations\n";
+        }
+    }
+
+    void
+    run()
+    {
+        testUrl();
+        testSmallUrl();
+        testStaticUrl();
+        testGlobal();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    alloc_stats_test,
+    "boost.url.alloc_stats");
+
+} // urls
+} // boost
@@ -0,0 +1,181 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/compact_url.hpp>
+
+#include <boost/url/parse.hpp>
+#include <string>
+#include <utility>
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct compact_url_test
+{
+    static
+    void
+    check(
+        host_interner& hi,
+        core::string_view s,
+        core::string_view expected)
+    {
+        url_view u0 = parse_uri_reference(s).value();
+        compact_url cu(u0, hi);
+        BOOST_TEST(cu.scheme_id() == u0.scheme_id());
+        BOOST_TEST_EQ(cu.port_number(), u0.port_number());
+        BOOST_TEST_EQ(cu.has_port(), u0.has_port());
+        BOOST_TEST_EQ(cu.encoded_resource(), u0.encoded_resource());
+        BOOST_TEST_EQ(hi.find(u0.encoded_host()).value(), cu.host_id());
+        BOOST_TEST_EQ(cu.size(hi), expected.size());
+
+        std::string buf;
+        url_view u1 = cu.view(hi, buf);
+        BOOST_TEST_EQ(u1.buffer(), expected);
+        BOOST_TEST_EQ(u1.buffer().data(), buf.data());
+        BOOST_TEST(u1 == u0);
+        BOOST_TEST_EQ(u1.encoded_path(), u0.encoded_path());
+        BOOST_TEST_EQ(u1.encoded_query(), u0.encoded_query());
+        BOOST_TEST_EQ(u1.encoded_fragment(), u0.encoded_fragment());
+        BOOST_TEST_EQ(u1.encoded_userinfo(), u0.encoded_userinfo());
+        BOOST_TEST_EQ(u1.port(), u0.port());
+
+        url u2 = cu.to_url(hi);
+        BOOST_TEST_EQ(u2.buffer(), expected);
+    }
+
+    void
+    testCompact()
+    {
+        host_interner hi;
+        check(hi, "", "");
+        check(hi, "/", "/");
+        check(hi, "x", "x");
+        check(hi, "https://www.example.com/a?b#c",
+            "https://www.example.com/a?b#c");
+        check(hi, "HTTPS://WWW.Example.com",
+            "https://www.example.com");
+        check(hi, "http://user:pass@h:8080/p",
+            "http://user:pass@h:8080/p");
+        check(hi, "http://@h:/p", "http://@h:/p");
+        check(hi, "http://h:0080", "http://h:0080");
+        check(hi, "Foo+Bar://h/", "foo+bar://h/");
+        check(hi, "mailto:a@b.com", "mailto:a@b.com");
+        check(hi, "file:///etc/hosts", "file:///etc/hosts");
+        check(hi, "//h?q", "//h?q");
+        check(hi, "http://[::1]/", "http://[::1]/");
+        check(hi, "http://192.168.0.1/", "http://192.168.0.1/");
+        check(hi, "http://%C3%A9/%c3", "http://%C3%A9/%c3");
+
+        // hosts are shared
+        auto const n = hi.size();
+        check(hi, "https://www.example.com/other",
+            "https://www.example.com/other");
+        BOOST_TEST_EQ(hi.size(), n);
+    }
+
+    void
+    testSpecial()
+    {
+        host_interner hi;
+        url_view u("http://www.example.com/path?q");
+
+        // compact_url()
+        {
+            compact_url cu;
+            BOOST_TEST(cu.scheme_id() == scheme::none);
+            BOOST_TEST_EQ(cu.encoded_resource(), "");
+            BOOST_TEST_EQ(cu.memory_usage(), sizeof(compact_url));
+        }
+
+        // compact_url(compact_url const&)
+        {
+            compact_url cu0(u, hi);
+            compact_url cu1(cu0);
+            std::string b0;
+            std::string b1;
+            BOOST_TEST_EQ(cu0.view(hi, b0).buffer(),
+                cu1.view(hi, b1).buffer());
+            BOOST_TEST_NE(cu0.encoded_resource().data(),
+                cu1.encoded_resource().data());
+        }
+
+        // compact_url(compact_url&&)
+        {
+            compact_url cu0(u, hi);
+            compact_url cu1(std::move(cu0));
+            BOOST_TEST_EQ(cu1.encoded_resource(), "/path?q");
+            BOOST_TEST_EQ(cu0.encoded_resource(), "");
+        }
+
+        // operator=(compact_url const&)
+        {
+            compact_url cu0(u, hi);
+            compact_url cu1;
+            cu1 = cu0;
+            BOOST_TEST_EQ(cu1.encoded_resource(), "/path?q");
+            BOOST_TEST(cu1.scheme_id() == scheme::http);
+        }
+
+        // operator=(compact_url&&)
+        {
+            compact_url cu0(u, hi);
+            compact_url cu1;
+            cu1 = std::move(cu0);
+            BOOST_TEST_EQ(cu1.encoded_resource(), "/path?q");
+            BOOST_TEST_EQ(cu0.encoded_resource(), "");
+        }
+
+        // memory_usage
+        {
+            compact_url cu(u, hi);
+            BOOST_TEST_EQ(cu.memory_usage(),
+                sizeof(compact_url) + 7);
+        }
+    }
+
+    void
+    testJavadocs()
+    {
+        // compact_url
+        {
+        host_interner hi;
+        compact_url cu( url_view( "https://www.example.com/path/to/file.txt?q=1" ), hi );
+
+        assert( hi.host( cu.host_id() ) == "www.example.com" );
+        assert( cu.encoded_resource() == "/path/to/file.txt?q=1" );
+
+        std::string buf;
+        url_view u = cu.view( hi, buf );
+        assert( u.buffer() == "https://www.example.com/path/to/file.txt?q=1" );
+        }
+    }
+
+    void
+    run()
+    {
+        testCompact();
+        testSpecial();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    compact_url_test,
+    "boost.url.compact_url");
+
+} // urls
+} // boost
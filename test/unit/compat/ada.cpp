@@ -1134,9 +1134,7 @@ struct ada_test
             u.normalize_path();
             // href: "http://[::7f00:1]"
             BOOST_TEST_CSTR_EQ(u.scheme(), "http");
-            // Boost.URL does not modify IP addresses
-            // Expected hostname in Ada: "[::7f00:1]"
-            BOOST_TEST_NOT(u.encoded_host() == "[::7f00:1]");
+            BOOST_TEST_CSTR_EQ(u.encoded_host(), "[::7f00:1]");
         }();
         []{
             system::result<url> base = parse_uri("http://example.org/foo/bar");
@@ -1157,9 +1155,7 @@ struct ada_test
             u.normalize_path();
             // href: "http://[::d01:4403]"
             BOOST_TEST_CSTR_EQ(u.scheme(), "http");
-            // Boost.URL does not modify IP addresses
-            // Expected hostname in Ada: "[::d01:4403]"
-            BOOST_TEST_NOT(u.encoded_host() == "[::d01:4403]");
+            BOOST_TEST_CSTR_EQ(u.encoded_host(), "[::d01:4403]");
         }();
         []{
             system::result<url> base = parse_uri("http://example.org/foo/bar");
@@ -7430,9 +7426,7 @@ struct ada_test
             u.normalize_path();
             // href: "http://[1::]"
             BOOST_TEST_CSTR_EQ(u.scheme(), "http");
-            // Boost.URL does not modify IP addresses
-            // Expected hostname in Ada: "[1::]"
-            BOOST_TEST_NOT(u.encoded_host() == "[1::]");
+            BOOST_TEST_CSTR_EQ(u.encoded_host(), "[1::]");
         }();
         []{
             system::result<url> base = parse_uri("http://example.net/");
@@ -8106,9 +8100,7 @@ struct ada_test
             u.normalize_path();
             // href: "non-special://[1:2:0:0:5::]/"
             BOOST_TEST_CSTR_EQ(u.scheme(), "non-special");
-            // Boost.URL does not modify IP addresses
-            // Expected hostname in Ada: "[1:2:0:0:5::]"
-            BOOST_TEST_NOT(u.encoded_host() == "[1:2:0:0:5::]");
+            BOOST_TEST_CSTR_EQ(u.encoded_host(), "[1:2:0:0:5::]");
         }();
         []{
             system::result<url> base = parse_uri("about:blank");
@@ -8124,9 +8116,7 @@ struct ada_test
             u.normalize_path();
             // href: "non-special://[1:2::3]/"
             BOOST_TEST_CSTR_EQ(u.scheme(), "non-special");
-            // Boost.URL does not modify IP addresses
-            // Expected hostname in Ada: "[1:2::3]"
-            BOOST_TEST_NOT(u.encoded_host() == "[1:2::3]");
+            BOOST_TEST_CSTR_EQ(u.encoded_host(), "[1:2::3]");
         }();
         []{
             system::result<url> base = parse_uri("about:blank");
@@ -0,0 +1,187 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/concurrent_url_set.hpp>
+
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <string>
+#include <vector>
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <atomic>
+# include <thread>
+#endif
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct concurrent_url_set_test
+{
+    static
+    std::string
+    make(std::size_t i)
+    {
+        return "https://host" + std::to_string(i % 97) +
+            ".example.com/path/" + std::to_string(i) +
+            "?q=" + std::to_string(i * 7);
+    }
+
+    void
+    testExact()
+    {
+        concurrent_url_set s;
+        BOOST_TEST(! s.is_filter());
+        BOOST_TEST_EQ(s.size(), 0u);
+        BOOST_TEST(! s.contains(url_view("http://example.com")));
+        BOOST_TEST(s.insert(url_view("http://example.com/a/b")));
+        BOOST_TEST(! s.insert(url_view("HTTP://EXAMPLE.COM/a/./b")));
+        BOOST_TEST(! s.insert(url("http://example.com/a/c/../b")));
+        BOOST_TEST(s.contains(url_view("http://example.com/%61/b")));
+        BOOST_TEST(! s.contains(url_view("http://example.com/a/b/")));
+        BOOST_TEST(s.insert(url_view("http://example.com/a/b/")));
+        BOOST_TEST(s.insert(url_view("")));
+        BOOST_TEST(! s.insert(url_view(".")));
+        BOOST_TEST_EQ(s.size(), 3u);
+
+        // growth, and a url larger than a block
+        std::string big = "http://example.com/" +
+            std::string(100000, 'x');
+        BOOST_TEST(s.insert(url_view(big)));
+        for(std::size_t i = 0; i < 5000; ++i)
+            BOOST_TEST(s.insert(url_view(make(i))));
+        for(std::size_t i = 0; i < 5000; ++i)
+            BOOST_TEST(! s.insert(url_view(make(i))));
+        BOOST_TEST(s.contains(url_view(big)));
+        BOOST_TEST_EQ(s.size(), 5004u);
+        BOOST_TEST_GT(s.memory_usage(), big.size());
+
+        s.clear();
+        BOOST_TEST_EQ(s.size(), 0u);
+        BOOST_TEST(! s.contains(url_view(make(1))));
+        BOOST_TEST(s.insert(url_view(make(1))));
+
+        // single shard
+        {
+            concurrent_url_set::options opt;
+            opt.shards = 1;
+            concurrent_url_set s1(opt);
+            for(std::size_t i = 0; i < 1000; ++i)
+                BOOST_TEST(s1.insert(url_view(make(i))));
+            for(std::size_t i = 0; i < 1000; ++i)
+                BOOST_TEST(s1.contains(url_view(make(i))));
+        }
+    }
+
+    void
+    testFilter()
+    {
+        concurrent_url_set::options opt;
+        opt.filter_bits = 1 << 16;
+        concurrent_url_set s(opt);
+        BOOST_TEST(s.is_filter());
+        BOOST_TEST_EQ(s.memory_usage(), 8192u);
+        BOOST_TEST(s.insert(url_view("http://example.com/a/b")));
+        BOOST_TEST(! s.insert(url_view("HTTP://EXAMPLE.COM/a/./b")));
+        BOOST_TEST(s.contains(url_view("http://example.com/%61/b")));
+
+        // no false negatives, few false positives
+        for(std::size_t i = 0; i < 4000; ++i)
+            s.insert(url_view(make(i)));
+        for(std::size_t i = 0; i < 4000; ++i)
+            BOOST_TEST(s.contains(url_view(make(i))));
+        std::size_t fp = 0;
+        for(std::size_t i = 4000; i < 14000; ++i)
+            fp += s.contains(url_view(make(i)));
+        BOOST_TEST_LT(fp, 100u);
+        BOOST_TEST_LE(s.size(), 4001u);
+
+        s.clear();
+        BOOST_TEST_EQ(s.size(), 0u);
+        BOOST_TEST(! s.contains(url_view(make(1))));
+
+        // rounding
+        opt.filter_bits = 1;
+        BOOST_TEST_EQ(concurrent_url_set(
+            opt).memory_usage(), 64u);
+
+        // bad options
+        opt.filter_hashes = 0;
+        BOOST_TEST_THROWS(concurrent_url_set{opt},
+            system::system_error);
+        opt.filter_hashes = 17;
+        BOOST_TEST_THROWS(concurrent_url_set{opt},
+            system::system_error);
+        opt = {};
+        opt.shards = 0;
+        BOOST_TEST_THROWS(concurrent_url_set{opt},
+            system::system_error);
+    }
+
+    void
+    testThreads()
+    {
+#if !defined(BOOST_URL_DISABLE_THREADS)
+        concurrent_url_set s;
+        std::atomic<std::size_t> inserted{0};
+        std::vector<std::thread> v;
+        for(std::size_t t = 0; t < 4; ++t)
+        {
+            v.emplace_back([&s, &inserted, t]
+            {
+                // every url is inserted by two threads
+                for(std::size_t i = 0; i < 2000; ++i)
+                    if(s.insert(url_view(make(
+                            i + 1000 * (t % 2)))))
+                        ++inserted;
+            });
+        }
+        for(auto& th : v)
+            th.join();
+        BOOST_TEST_EQ(inserted.load(), 3000u);
+        BOOST_TEST_EQ(s.size(), 3000u);
+#endif
+    }
+
+    void
+    testJavadocs()
+    {
+        // concurrent_url_set
+        {
+        concurrent_url_set seen;
+
+        assert( seen.insert( url_view( "https://www.example.com/index.htm" ) ) );
+        assert( ! seen.insert( url_view( "HTTPS://WWW.EXAMPLE.COM/./index.htm" ) ) );
+        }
+    }
+
+    void
+    run()
+    {
+        testExact();
+        testFilter();
+        testThreads();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    concurrent_url_set_test,
+    "boost.url.concurrent_url_set");
+
+} // urls
+} // boost
@@ -0,0 +1,297 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/decode_as.hpp>
+
+#include <boost/url/grammar/error.hpp>
+#include <boost/url/params_view.hpp>
+#include <boost/url/url_view.hpp>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <locale>
+#include <new>
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace {
+
+// the number of calls to operator new
+std::atomic<std::size_t> new_count(0);
+
+} // (anon)
+
+void*
+operator new(std::size_t n)
+{
+    ++new_count;
+    if(void* p = std::malloc(n != 0 ? n : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void
+operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void
+operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace boost {
+namespace urls {
+
+struct decode_as_test
+{
+    template<class T>
+    static
+    void
+    ok(
+        pct_string_view s,
+        T v,
+        encoding_opts opt = {})
+    {
+        auto rv = decode_as<T>(s, opt);
+        if(BOOST_TEST(rv.has_value()))
+            BOOST_TEST_EQ(*rv, v);
+    }
+
+    template<class T>
+    static
+    void
+    bad(
+        pct_string_view s,
+        grammar::error e,
+        encoding_opts opt = {})
+    {
+        auto rv = decode_as<T>(s, opt);
+        if(BOOST_TEST(rv.has_error()))
+            BOOST_TEST_EQ(rv.error(), e);
+    }
+
+    void
+    testBool()
+    {
+        ok<bool>("1", true);
+        ok<bool>("true", true);
+        ok<bool>("TRUE", true);
+        ok<bool>("yes", true);
+        ok<bool>("On", true);
+        ok<bool>("%74rue", true);
+        ok<bool>("0", false);
+        ok<bool>("false", false);
+        ok<bool>("no", false);
+        ok<bool>("off", false);
+        ok<bool>("%30", false);
+        bad<bool>("", grammar::error::mismatch);
+        bad<bool>("2", grammar::error::mismatch);
+        bad<bool>("truee", grammar::error::mismatch);
+        bad<bool>("t", grammar::error::mismatch);
+        bad<bool>("onoffonoffonoff", grammar::error::mismatch);
+    }
+
+    void
+    testUnsigned()
+    {
+        ok<unsigned>("0", 0);
+        ok<unsigned>("50", 50);
+        ok<unsigned>("%35%30", 50);
+        ok<unsigned short>("65535", 65535);
+        ok<std::uint64_t>("18446744073709551615",
+            (std::numeric_limits<std::uint64_t>::max)());
+        bad<unsigned>("", grammar::error::mismatch);
+        bad<unsigned>("x", grammar::error::mismatch);
+        bad<unsigned>("-1", grammar::error::mismatch);
+        bad<unsigned>("+1", grammar::error::mismatch);
+        bad<unsigned>("01", grammar::error::invalid);
+        bad<unsigned>("1x", grammar::error::leftover);
+        bad<unsigned>("1%20", grammar::error::leftover);
+        bad<unsigned short>("65536", grammar::error::out_of_range);
+        bad<unsigned char>("1000", grammar::error::out_of_range);
+        bad<unsigned char>("256x", grammar::error::out_of_range);
+        bad<unsigned char>("00", grammar::error::invalid);
+        bad<std::uint64_t>("18446744073709551616",
+            grammar::error::out_of_range);
+        bad<std::uint64_t>("99999999999999999999999",
+            grammar::error::out_of_range);
+
+        // space_as_plus
+        ok<int>("+1", 1);
+        bad<int>("+1", grammar::error::mismatch,
+            encoding_opts(true));
+        bad<unsigned>("1+", grammar::error::leftover,
+            encoding_opts(true));
+    }
+
+    void
+    testSigned()
+    {
+        ok<int>("0", 0);
+        ok<int>("-0", 0);
+        ok<int>("+42", 42);
+        ok<int>("-42", -42);
+        ok<int>("%2D42", -42);
+        ok<signed char>("127", 127);
+        ok<signed char>("-128", -128);
+        ok<short>("-32768", -32768);
+        ok<std::int64_t>("9223372036854775807",
+            (std::numeric_limits<std::int64_t>::max)());
+        ok<std::int64_t>("-9223372036854775808",
+            (std::numeric_limits<std::int64_t>::min)());
+        bad<int>("", grammar::error::mismatch);
+        bad<int>("-", grammar::error::mismatch);
+        bad<int>("--1", grammar::error::mismatch);
+        bad<int>("-01", grammar::error::invalid);
+        bad<signed char>("128", grammar::error::out_of_range);
+        bad<signed char>("200", grammar::error::out_of_range);
+        bad<signed char>("1000", grammar::error::out_of_range);
+        bad<signed char>("-1000", grammar::error::out_of_range);
+        bad<signed char>("-129", grammar::error::out_of_range);
+        bad<std::int64_t>("9223372036854775808",
+            grammar::error::out_of_range);
+        bad<std::int64_t>("-9223372036854775809",
+            grammar::error::out_of_range);
+    }
+
+    void
+    testFloat()
+    {
+        ok<double>("0", 0);
+        ok<double>("1.5", 1.5);
+        ok<double>("-1.5", -1.5);
+        ok<double>("+.5", .5);
+        ok<double>("5.", 5);
+        ok<double>("1e3", 1000);
+        ok<double>("1E-3", 0.001);
+        ok<double>("2.5e+2", 250);
+        ok<double>("%31%2E5", 1.5);
+        ok<float>("0.25", 0.25f);
+        ok<long double>("-0.125", -0.125L);
+        ok<double>("1e-400", 0);
+        ok<double>("-0.0001e-99999999999999999999", 0);
+        ok<float>("1e-50", 0);
+        bad<double>("", grammar::error::mismatch);
+        bad<double>(".", grammar::error::mismatch);
+        bad<double>("-", grammar::error::mismatch);
+        bad<double>("e3", grammar::error::mismatch);
+        bad<double>("inf", grammar::error::mismatch);
+        bad<double>("nan", grammar::error::mismatch);
+        bad<double>("0x10", grammar::error::leftover);
+        bad<double>("1e", grammar::error::invalid);
+        bad<double>("1e+", grammar::error::invalid);
+        bad<double>("1.5.", grammar::error::leftover);
+        bad<double>("1,5", grammar::error::leftover);
+        bad<double>("1e400", grammar::error::out_of_range);
+        bad<float>("1e39", grammar::error::out_of_range);
+        bad<double>("0.001e99999999999999999999",
+            grammar::error::out_of_range);
+        bad<double>(std::string(200, '1'),
+            grammar::error::out_of_range);
+
+        // correctly rounded
+        ok<double>("0.1", 0.1);
+        ok<double>("1.7976931348623157e308",
+            (std::numeric_limits<double>::max)());
+        ok<double>("4.9406564584124654e-324",
+            std::numeric_limits<double>::denorm_min());
+        ok<float>("3.4028235e38",
+            (std::numeric_limits<float>::max)());
+
+        // the global locale is not used
+        struct comma_punct
+            : std::numpunct<char>
+        {
+            char do_decimal_point() const override
+            {
+                return ',';
+            }
+
+            char do_thousands_sep() const override
+            {
+                return '.';
+            }
+
+            std::string do_grouping() const override
+            {
+                return "\3";
+            }
+        };
+        auto const saved = std::locale::global(
+            std::locale(std::locale::classic(),
+                new comma_punct));
+        ok<double>("1.5", 1.5);
+        ok<double>("1234.5", 1234.5);
+        bad<double>("1,5", grammar::error::leftover);
+        std::locale::global(saved);
+    }
+
+    void
+    testAllocation()
+    {
+        url_view u("?ratio=0.5&n=-7&big=1e400");
+        params_view p = u.params();
+
+        // once, for any state created
+        // on first use
+        (void)decode_as<double>("0.5");
+        (void)decode_as<float>("0.5");
+        (void)decode_as<long double>("0.5");
+
+        auto const n = new_count.load();
+        BOOST_TEST_EQ(decode_as<double>("%31.5").value(), 1.5);
+        BOOST_TEST_EQ(decode_as<float>("-2.5e1").value(), -25.f);
+        BOOST_TEST_EQ(decode_as<long double>("+.25").value(), .25L);
+        BOOST_TEST(decode_as<double>("1e400").has_error());
+        BOOST_TEST_EQ(decode_as<int>("-42").value(), -42);
+        BOOST_TEST_EQ(decode_as<unsigned>("42").value(), 42u);
+        BOOST_TEST_EQ(p.get_as<double>("ratio").value(), 0.5);
+        BOOST_TEST_EQ(p.get_as<int>("n").value(), -7);
+        BOOST_TEST(p.get_as<double>("big").has_error());
+        BOOST_TEST_EQ(new_count.load(), n);
+    }
+
+    void
+    testJavadocs()
+    {
+        // decode_as
+        {
+        system::result< int > rv = decode_as< int >( "%2D42" );
+        assert( rv.value() == -42 );
+        }
+    }
+
+    void
+    run()
+    {
+        testBool();
+        testUnsigned();
+        testSigned();
+        testFloat();
+        testAllocation();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    decode_as_test,
+    "boost.url.decode_as");
+
+} // urls
+} // boost
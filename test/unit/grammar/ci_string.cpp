@@ -131,6 +131,55 @@ public:
         BOOST_TEST_EQ(ci_compare("bA", "BB"), -1);
     }
 
+    void
+    testBlocks()
+    {
+        // strings spanning several blocks,
+        // differing at every position
+        std::string const s0 =
+            "abcdefghijklmnopqrstuvwxyz"
+            "@[`{0123456789-._~ABCDEFGHIJ";
+        std::string s1 = s0;
+        for(auto& c : s1)
+            c = to_upper(c);
+        BOOST_TEST(ci_is_equal(s0, s1));
+        BOOST_TEST_EQ(ci_compare(s0, s1), 0);
+        BOOST_TEST(! ci_is_less(s0, s1));
+        BOOST_TEST(! ci_is_less(s1, s0));
+        for(std::size_t n = 0; n <= s0.size(); ++n)
+            BOOST_TEST_EQ(
+                ci_digest(s0.substr(0, n)),
+                ci_digest(s1.substr(0, n)));
+        for(std::size_t i = 0; i < s0.size(); ++i)
+        {
+            std::string s2 = s1;
+            s2[i] = '\x7f';
+            BOOST_TEST(! ci_is_equal(s0, s2));
+            BOOST_TEST_EQ(ci_compare(s0, s2), -1);
+            BOOST_TEST_EQ(ci_compare(s2, s0), 1);
+            BOOST_TEST(ci_is_less(s0, s2));
+            BOOST_TEST(! ci_is_less(s2, s0));
+            BOOST_TEST_NE(ci_digest(s0), ci_digest(s2));
+        }
+
+        // characters adjacent to the letters
+        BOOST_TEST(! ci_is_equal(
+            "@@@@@@@@[[[[[[[[", "````````{{{{{{{{"));
+        BOOST_TEST_EQ(ci_compare(
+            "0123456789abcdef@", "0123456789ABCDEF`"), -1);
+        BOOST_TEST_NE(
+            ci_digest("@@@@@@@@[[[[[[[["),
+            ci_digest("````````{{{{{{{{"));
+
+        // zero padding is not ambiguous
+        BOOST_TEST_NE(
+            ci_digest(core::string_view("abc", 3)),
+            ci_digest(core::string_view("abc\0", 4)));
+        BOOST_TEST_NE(
+            ci_digest(core::string_view("abcdefgh", 8)),
+            ci_digest(core::string_view("abcdefgh\0", 9)));
+    }
+
     void
     run()
     {
@@ -164,6 +213,7 @@ public:
         testIsEqual();
         testIsLess();
         testCompare();
+        testBlocks();
     }
 };
 
@@ -75,6 +75,72 @@ struct string_token_test
             sv = f(string_token::preserve_size(s));
             BOOST_TEST_EQ(sv, "test");
         }
+
+        // in_arena
+        {
+            char buf[8];
+            string_token::arena a(buf, sizeof(buf));
+            core::string_view sv0 = f(string_token::in_arena(a));
+            BOOST_TEST_EQ(sv0, "test");
+            BOOST_TEST_EQ(sv0.data(), buf);
+            core::string_view sv1 = f(string_token::in_arena(a));
+            BOOST_TEST_EQ(sv1.data(), buf + 4);
+            BOOST_TEST_EQ(a.used(), 8u);
+
+            // spills to the heap
+            std::string big(3000, 'x');
+            core::string_view sv2 = f(string_token::in_arena(a), big);
+            core::string_view sv3 = f(string_token::in_arena(a));
+            core::string_view sv4 = f(string_token::in_arena(a), big);
+            BOOST_TEST_EQ(sv0, "test");
+            BOOST_TEST_EQ(sv1, "test");
+            BOOST_TEST_EQ(sv2, big);
+            BOOST_TEST_EQ(sv3, "test");
+            BOOST_TEST_EQ(sv4, big);
+            BOOST_TEST_EQ(a.used(), 6012u);
+
+            // reused after release
+            a.release();
+            BOOST_TEST_EQ(a.used(), 0u);
+            BOOST_TEST_EQ(f(string_token::in_arena(a)).data(), buf);
+            sv2 = f(string_token::in_arena(a), big);
+            sv4 = f(string_token::in_arena(a), big);
+            a.release();
+            sv2 = f(string_token::in_arena(a), big);
+            sv4 = f(string_token::in_arena(a), big);
+            BOOST_TEST_EQ(sv4.data(), sv2.data() + big.size());
+            a.release();
+            core::string_view sv5 = f(string_token::in_arena(a), big);
+            BOOST_TEST_EQ(sv5.data(), sv2.data());
+
+            // without a buffer
+            string_token::arena a1;
+            BOOST_TEST_EQ(f(string_token::in_arena(a1)), "test");
+            BOOST_TEST_EQ(f(string_token::in_arena(a1), ""), "");
+        }
+
+        // write_to
+        {
+            char buf[6];
+            auto rv = f(string_token::write_to(buf, sizeof(buf)));
+            if(BOOST_TEST(rv.has_value()))
+            {
+                BOOST_TEST_EQ(*rv, "test");
+                BOOST_TEST_EQ(rv->data(), buf);
+            }
+            rv = f(string_token::write_to(buf, 4));
+            BOOST_TEST(rv.has_value());
+            rv = f(string_token::write_to(buf, sizeof(buf)), "urltest");
+            if(BOOST_TEST(rv.has_error()))
+            {
+                BOOST_TEST(rv.error() ==
+                    system::errc::value_too_large);
+                BOOST_TEST_EQ(core::string_view(
+                    buf, sizeof(buf)), "urltes");
+            }
+            rv = f(string_token::write_to(nullptr, 0), "");
+            BOOST_TEST(rv.has_value());
+        }
     }
 };
 
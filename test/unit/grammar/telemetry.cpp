@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/grammar/telemetry.hpp>
+
+#include <boost/url/grammar/literal_rule.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/parse.hpp>
+#include <sstream>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace urls {
+namespace grammar {
+
+// a rule with a name no other test uses
+struct telemetry_test_rule
+{
+    using value_type = core::string_view;
+
+    system::result<value_type>
+    parse(
+        char const*& it,
+        char const* end) const noexcept
+    {
+        auto rv = grammar::parse(
+            it, end, literal_rule("ab"));
+        if(! rv)
+            return rv.error();
+        if( it != end &&
+            *it == '!')
+            return error::invalid;
+        return *rv;
+    }
+};
+
+struct telemetry_test
+{
+    static
+    rule_telemetry
+    find(core::string_view name)
+    {
+        for(auto const& t : telemetry_snapshot())
+            if(core::string_view(t.name).ends_with(name))
+                return t;
+        return {};
+    }
+
+    void
+    testCounters()
+    {
+        telemetry_test_rule const r;
+        parse("ab", r);
+        parse("abab", r);
+        parse("ab!", r);
+        parse("a", r);
+        parse("x", r);
+        char const* it = "abc";
+        parse(it, it + 3, r);
+
+        auto const t = find("telemetry_test_rule");
+#ifdef BOOST_URL_ENABLE_TELEMETRY
+        BOOST_TEST_EQ(t.calls, 6u);
+        BOOST_TEST_EQ(t.failures, 3u);
+        // "ab" three times, leftovers
+        // are not failures of the rule
+        BOOST_TEST_EQ(t.bytes, 6u);
+        BOOST_TEST_EQ(t.errors[static_cast<
+            int>(error::invalid)], 1u);
+        BOOST_TEST_EQ(t.errors[static_cast<
+            int>(error::need_more)], 1u);
+        BOOST_TEST_EQ(t.errors[static_cast<
+            int>(error::mismatch)], 1u);
+        BOOST_TEST_EQ(t.errors[0], 0u);
+
+        // nested rules are counted too
+        auto const l = find("literal_rule");
+        BOOST_TEST_GE(l.calls, 6u);
+
+        // rules of the library
+        BOOST_TEST(parse_uri("http://example.com:80/").has_value());
+        BOOST_TEST(parse_uri("http://example.com:x/").has_error());
+        BOOST_TEST_GE(find("port_rule").calls, 2u);
+        BOOST_TEST_GE(find("uri_rule_t").failures, 1u);
+
+        telemetry_reset();
+        BOOST_TEST_EQ(find("telemetry_test_rule").calls, 0u);
+        BOOST_TEST_EQ(find("telemetry_test_rule").failures, 0u);
+        parse("ab", r);
+        BOOST_TEST_EQ(find("telemetry_test_rule").calls, 1u);
+#else
+        BOOST_TEST_EQ(t.calls, 0u);
+        BOOST_TEST(telemetry_snapshot().empty());
+        telemetry_reset();
+#endif
+    }
+
+    void
+    testJavadocs()
+    {
+        // telemetry_snapshot
+        {
+        std::stringstream out;
+        for( auto const& t : telemetry_snapshot() )
+            out << t.name << ": " << t.failures << " of " << t.calls << "\n";
+        }
+    }
+
+    void
+    run()
+    {
+        testCounters();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    telemetry_test,
+    "boost.url.grammar.telemetry");
+
+} // grammar
+} // urls
+} // boost
@@ -12,6 +12,7 @@
 
 #include <boost/url/grammar/delim_rule.hpp>
 #include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/tuple_rule.hpp>
 #include <boost/url/rfc/absolute_uri_rule.hpp>
 #include <boost/url/rfc/authority_rule.hpp>
 #include <boost/url/rfc/origin_form_rule.hpp>
@@ -24,9 +25,88 @@ namespace grammar {
 
 struct variant_rule_test
 {
+    // counts invocations of parse
+    struct counted_rule
+    {
+        using value_type = core::string_view;
+
+        char ch;
+        int* n;
+
+        system::result<value_type>
+        parse(
+            char const*& it,
+            char const* end) const noexcept
+        {
+            ++*n;
+            return delim_rule(ch).parse(it, end);
+        }
+
+        bool
+        first_chars(char c) const noexcept
+        {
+            return c == ch;
+        }
+    };
+
+    void
+    testFirstChars()
+    {
+        int n0 = 0;
+        int n1 = 0;
+        auto const r = variant_rule(
+            counted_rule{'a', &n0},
+            counted_rule{'b', &n1});
+
+        auto rv = parse("b", r);
+        if(BOOST_TEST(rv.has_value()))
+            BOOST_TEST_EQ(rv->index(), 1u);
+        BOOST_TEST_EQ(n0, 0);
+        BOOST_TEST_EQ(n1, 1);
+
+        rv = parse("c", r);
+        BOOST_TEST_EQ(rv.error(), error::mismatch);
+        rv = parse("", r);
+        BOOST_TEST_EQ(rv.error(), error::mismatch);
+        BOOST_TEST_EQ(n0, 0);
+        BOOST_TEST_EQ(n1, 1);
+
+        // declared through squelch and tuple_rule
+        auto const r2 = variant_rule(
+            tuple_rule(
+                squelch(counted_rule{'a', &n0}),
+                delim_rule('1')),
+            tuple_rule(
+                squelch(counted_rule{'b', &n1}),
+                delim_rule('2')));
+        auto rv2 = parse("b2", r2);
+        if(BOOST_TEST(rv2.has_value()))
+            BOOST_TEST_EQ(rv2->index(), 1u);
+        BOOST_TEST_EQ(n0, 0);
+        BOOST_TEST_EQ(n1, 2);
+
+        // rules without first_chars are invoked
+        auto const r3 = variant_rule(
+            origin_form_rule,
+            absolute_uri_rule,
+            authority_rule,
+            delim_rule('*'));
+        auto rv3 = parse("127.0.0.1:80", r3);
+        if(BOOST_TEST(rv3.has_value()))
+            BOOST_TEST_EQ(rv3->index(), 2u);
+        rv3 = parse("http://www.example.com", r3);
+        if(BOOST_TEST(rv3.has_value()))
+            BOOST_TEST_EQ(rv3->index(), 1u);
+        rv3 = parse("/path", r3);
+        if(BOOST_TEST(rv3.has_value()))
+            BOOST_TEST_EQ(rv3->index(), 0u);
+    }
+
     void
     run()
     {
+        testFirstChars();
+
         // constexpr
         constexpr auto r =
             variant_rule(
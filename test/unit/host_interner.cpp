@@ -0,0 +1,251 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/host_interner.hpp>
+
+#include <boost/url/url_view.hpp>
+#include <string>
+#include <vector>
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <atomic>
+# include <thread>
+#endif
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct host_interner_test
+{
+    void
+    testSpecial()
+    {
+        BOOST_TEST_THROWS(
+            host_interner(0),
+            system::system_error);
+
+        host_interner hi;
+        BOOST_TEST_EQ(hi.size(), 0);
+        BOOST_TEST(! hi.find("www.example.com"));
+        BOOST_TEST_GT(hi.memory_usage(), 0);
+
+        host_interner hi1(1);
+        BOOST_TEST_EQ(hi1.intern("a"), 0);
+        BOOST_TEST_EQ(hi1.intern("b"), 1);
+        BOOST_TEST_EQ(hi1.intern("A"), 0);
+    }
+
+    void
+    testIntern()
+    {
+        host_interner hi;
+        BOOST_TEST_EQ(hi.intern("www.example.com"), 0);
+        BOOST_TEST_EQ(hi.intern(""), 1);
+        BOOST_TEST_EQ(hi.intern("WWW.Example.COM"), 0);
+        BOOST_TEST_EQ(hi.intern("[::1]"), 2);
+        BOOST_TEST_EQ(hi.intern("[::A]"), 3);
+        BOOST_TEST_EQ(hi.intern("[::a]"), 3);
+        BOOST_TEST_EQ(hi.size(), 4);
+
+        BOOST_TEST_EQ(hi.host(0), "www.example.com");
+        BOOST_TEST_EQ(hi.host(1), "");
+        BOOST_TEST_EQ(hi.host(3), "[::a]");
+
+        // escapes are normalized to upper case
+        BOOST_TEST_EQ(hi.intern("%c3%a9T%aA"), 4);
+        BOOST_TEST_EQ(hi.host(4), "%C3%A9t%AA");
+        BOOST_TEST_EQ(hi.intern("%C3%A9t%Aa"), 4);
+        BOOST_TEST(hi.intern("%C3%A9t%AB") != 4);
+
+        // find
+        BOOST_TEST_EQ(hi.find("WWW.EXAMPLE.COM").value(), 0);
+        BOOST_TEST_EQ(hi.find("").value(), 1);
+        BOOST_TEST(! hi.find("example.com"));
+
+        // equivalent hosts
+        BOOST_TEST_EQ(hi.intern("%77ww.Example.com"), 0);
+        BOOST_TEST_EQ(hi.find("www%2Eexample%2ecom").value(), 0);
+        BOOST_TEST_EQ(hi.intern("[0:0::0:1]"), 2);
+        BOOST_TEST_EQ(hi.find("[0:0:0:0:0:0:0:A]").value(), 3);
+        BOOST_TEST_EQ(hi.intern("%2C%41"), 6);
+        BOOST_TEST_EQ(hi.host(6), ",a");
+        BOOST_TEST_EQ(hi.intern(",A"), 6);
+        BOOST_TEST_EQ(hi.intern("a%20b"), 7);
+        BOOST_TEST_EQ(hi.host(7), "a%20b");
+        BOOST_TEST_EQ(hi.intern("[v1.X]"), 8);
+        BOOST_TEST_EQ(hi.intern("[v1.x]"), 8);
+        BOOST_TEST_EQ(hi.size(), 9);
+    }
+
+    void
+    testCompare()
+    {
+        // same id exactly when the
+        // urls compare equal
+        char const* const v[] = {
+            "http://www.example.com/",
+            "http://WWW.EXAMPLE.COM/",
+            "http://%77ww.example.com/",
+            "http://www%2Eexample.com/",
+            "http://www.example.org/",
+            "http://[::1]/",
+            "http://[0::1]/",
+            "http://[0:0:0:0:0:0:0:1]/",
+            "http://[::2]/",
+            "http://[::ffff:1.2.3.4]/",
+            "http://[::FFFF:102:304]/",
+            "http://a%2cb/",
+            "http://a,B/",
+            "http://a%25b/",
+            "http://1.2.3.4/",
+            "http://[v1.x]/",
+            "http://[v1.X]/",
+            "http:///",
+        };
+        host_interner hi;
+        for(auto a : v)
+        {
+            for(auto b : v)
+            {
+                url_view const ua(a);
+                url_view const ub(b);
+                BOOST_TEST_EQ(
+                    hi.intern(ua.encoded_host()) ==
+                        hi.intern(ub.encoded_host()),
+                    ua.compare(ub) == 0);
+            }
+        }
+    }
+
+    void
+    testMany()
+    {
+        // spans several segments
+        host_interner hi(4);
+        std::size_t const n = 5000;
+        for(std::size_t i = 0; i < n; ++i)
+            BOOST_TEST_EQ(hi.intern(
+                "host" + std::to_string(i) +
+                ".example.com"), i);
+        BOOST_TEST_EQ(hi.size(), n);
+        for(std::size_t i = 0; i < n; i += 7)
+        {
+            auto const s = "HOST" +
+                std::to_string(i) + ".EXAMPLE.COM";
+            BOOST_TEST_EQ(hi.find(s).value(), i);
+            BOOST_TEST_EQ(hi.host(
+                static_cast<std::uint32_t>(i)),
+                "host" + std::to_string(i) +
+                    ".example.com");
+        }
+    }
+
+    void
+    testThreads()
+    {
+#if !defined(BOOST_URL_DISABLE_THREADS)
+        // ids are dense and agree
+        // across threads
+        host_interner hi;
+        std::size_t const n = 2000;
+        std::size_t const nt = 4;
+        std::vector<std::vector<std::uint32_t>> ids(nt);
+        std::vector<std::thread> v;
+        for(std::size_t t = 0; t < nt; ++t)
+        {
+            v.emplace_back([&, t]
+            {
+                for(std::size_t i = 0; i < n; ++i)
+                {
+                    auto const j = (i * (t + 1)) % n;
+                    auto const id = hi.intern(
+                        "h" + std::to_string(j));
+                    if(hi.host(id) != "h" + std::to_string(j))
+                        return;
+                    ids[t].push_back(id);
+                }
+            });
+        }
+        // lookups take no lock
+        std::atomic<bool> bad{false};
+        v.emplace_back([&]
+        {
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                auto const s = "h" + std::to_string(i);
+                auto const id = hi.find(s);
+                if( id &&
+                    hi.host(*id) != s)
+                    bad = true;
+            }
+        });
+        for(auto& th : v)
+            th.join();
+        BOOST_TEST(! bad);
+        BOOST_TEST_EQ(hi.size(), n);
+        for(std::size_t i = 0; i < n; ++i)
+            BOOST_TEST(hi.find(
+                "h" + std::to_string(i)).has_value());
+        std::vector<std::uint32_t> seen(n, 0xffffffff);
+        for(std::size_t t = 0; t < nt; ++t)
+        {
+            if(! BOOST_TEST_EQ(ids[t].size(), n))
+                continue;
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                auto const j = (i * (t + 1)) % n;
+                auto const id = ids[t][i];
+                BOOST_TEST_LT(id, n);
+                if(seen[j] == 0xffffffff)
+                    seen[j] = id;
+                BOOST_TEST_EQ(seen[j], id);
+            }
+        }
+#endif
+    }
+
+    void
+    testJavadocs()
+    {
+        // host_interner
+        {
+        host_interner hi;
+        auto id = hi.intern( url_view( "https://WWW.Example.com/" ).encoded_host() );
+
+        assert( hi.intern( "www.example.com" ) == id );
+        assert( hi.host( id ) == "www.example.com" );
+        }
+    }
+
+    void
+    run()
+    {
+        testSpecial();
+        testIntern();
+        testCompare();
+        testMany();
+        testThreads();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    host_interner_test,
+    "boost.url.host_interner");
+
+} // urls
+} // boost
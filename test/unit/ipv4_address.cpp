@@ -11,6 +11,7 @@
 #include <boost/url/ipv4_address.hpp>
 
 #include "test_suite.hpp"
+#include <cstdint>
 #include <sstream>
 
 namespace boost {
@@ -224,6 +225,19 @@ public:
         bad("1.2.3.4.");
         bad("1.2.3.4x");
         bad("1.2.3.300");
+        bad("1.2.3.04");
+        bad("1.2.3.2555");
+        bad("1..2.3.4");
+        bad(".1.2.3.4");
+        bad("1.2.3.4.5");
+        bad("1.2.3:4");
+        bad("1.2.3.\xb4");
+        bad("1.2.3./");
+        bad("0001.2.3.4");
+        bad("1.2.3.4 ");
+        bad("255.255.255.255.");
+        bad("255.255.255.2555");
+        bad(core::string_view("1.2.3.\0", 7));
 
         good("0.0.0.0");
         good("1.2.3.4");
@@ -233,6 +247,18 @@ public:
         check("1.2.3.4", 0x01020304);
         check("32.64.128.1", 0x20408001);
         check("255.255.255.255", 0xffffffff);
+        check("10.100.200.99", 0x0a64c863);
+        check("199.249.250.9", 0xc7f9fa09);
+
+        // round trip
+        for(std::uint64_t i = 0; i < 0x100000000; i += 0x010100ef)
+        {
+            auto const v = static_cast<
+                ipv4_address::uint_type>(i);
+            char buf[ipv4_address::max_str_len];
+            ipv4_address const a(v);
+            check(a.to_buffer(buf, sizeof(buf)), v);
+        }
     }
 
     void
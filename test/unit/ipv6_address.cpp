@@ -14,6 +14,11 @@
 #include "test_suite.hpp"
 #include <sstream>
 
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
 namespace boost {
 namespace urls {
 
@@ -297,6 +302,33 @@ public:
               "1234:1234:1234:1234:1234:1234:ffff:ffff");
         trip("0:0:0:0:0:ffff:1.2.3.4", "::ffff:1.2.3.4");
 
+        // rfc5952
+        trip("1:0:2:3:4:5:6:7", "1:0:2:3:4:5:6:7");
+        trip("1:2:3:4:5:6:7:0", "1:2:3:4:5:6:7:0");
+        trip("0:1:2:3:4:5:6:7", "0:1:2:3:4:5:6:7");
+        trip("1:0:0:2:0:0:3:4", "1::2:0:0:3:4");
+        trip("1:0:0:2:0:0:0:3", "1:0:0:2::3");
+        trip("2001:0DB8:0000:0000:0001:0000:0000:0001",
+             "2001:db8::1:0:0:1");
+        trip("0:0:1:0:0:0:0:1", "0:0:1::1");
+        trip("::ffff:0:0", "::ffff:0.0.0.0");
+        trip("::fffe:1.2.3.4", "::fffe:102:304");
+        trip("ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255",
+             "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff");
+
+        bad("1:2:3:4:5:6:7:8:9");
+        bad("1:2:3:4:5:6:7::8");
+        bad("1::2:3:4:5:6:7:8");
+        bad("1:2:3:4:5:6::1.2.3.4");
+        bad("12345::");
+        bad("::12345");
+        bad("1:::2");
+        bad("1::2::");
+        bad("::1:");
+        bad("::1.2.3.4:5");
+        bad("::1234.1.1.1");
+        bad("::1%eth0");
+
         check("1:2:3:4:5:6:7:8", 0x0001000200030004, 0x0005000600070008);
         check("::2:3:4:5:6:7:8", 0x0000000200030004, 0x0005000600070008);
         check("1::3:4:5:6:7:8",  0x0001000000030004, 0x0005000600070008);
@@ -402,12 +434,81 @@ public:
                 "::ffff:127.0.0.1");
     }
 
+    void
+    testBulk()
+    {
+        // parse_ipv6_addresses
+        {
+            core::string_view s[4] = {
+                "::1", "2001:DB8::1", "x", "::" };
+            ipv6_address a[4];
+            BOOST_TEST_EQ(parse_ipv6_addresses(
+                s, 2, a), 2u);
+            BOOST_TEST_EQ(a[0], ipv6_address::loopback());
+            BOOST_TEST_EQ(a[1], ipv6_address("2001:db8::1"));
+            BOOST_TEST_EQ(parse_ipv6_addresses(
+                s, 4, a), 2u);
+            BOOST_TEST_EQ(parse_ipv6_addresses(
+                s + 3, 1, a + 3), 1u);
+            BOOST_TEST(a[3].is_unspecified());
+            BOOST_TEST_EQ(parse_ipv6_addresses(
+                s, 0, a), 0u);
+        }
+
+        // print_ipv6_addresses
+        {
+            ipv6_address a[3] = {
+                ipv6_address("1:0:0:0:0:0:0:2"),
+                ipv6_address(ipv4_address("1.2.3.4")),
+                ipv6_address() };
+            char buf[3 * ipv6_address::max_str_len];
+            std::size_t sizes[3];
+            BOOST_TEST_EQ(print_ipv6_addresses(
+                a, 3, buf, sizeof(buf), sizes), 3u);
+            BOOST_TEST_EQ(sizes[0], 4u);
+            BOOST_TEST_EQ(sizes[1], 14u);
+            BOOST_TEST_EQ(sizes[2], 2u);
+            BOOST_TEST_EQ(core::string_view(buf, 20),
+                "1::2::ffff:1.2.3.4::");
+
+            // partial
+            BOOST_TEST_EQ(print_ipv6_addresses(
+                a, 3, buf, 17, sizes), 1u);
+            BOOST_TEST_EQ(print_ipv6_addresses(
+                a, 3, buf, 18, sizes), 2u);
+            BOOST_TEST_EQ(print_ipv6_addresses(
+                a, 3, buf, 3, sizes), 0u);
+        }
+    }
+
+    void
+    testJavadocs()
+    {
+        // parse_ipv6_addresses
+        {
+        core::string_view s[2] = { "::1", "2001:db8::" };
+        ipv6_address a[2];
+        assert( parse_ipv6_addresses( s, 2, a ) == 2 );
+        }
+
+        // print_ipv6_addresses
+        {
+        ipv6_address a[2] = { ipv6_address::loopback(), ipv6_address() };
+        char buf[ 2 * ipv6_address::max_str_len ];
+        std::size_t sizes[2];
+        assert( print_ipv6_addresses( a, 2, buf, sizeof(buf), sizes ) == 2 );
+        assert( core::string_view( buf, sizes[0] + sizes[1] ) == "::1::" );
+        }
+    }
+
     void
     run()
     {
         testMembers();
         testIO();
         testIpv4();
+        testBulk();
+        testJavadocs();
     }
 };
 
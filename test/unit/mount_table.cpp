@@ -0,0 +1,156 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/mount_table.hpp>
+
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <iterator>
+#include <string>
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct mount_table_test
+{
+    // return "id:rest" or "none"
+    static
+    std::string
+    find(
+        mount_table const& mt,
+        core::string_view path)
+    {
+        segments_encoded_view segs(path);
+        auto m = mt.find(segs);
+        if(! m)
+            return "none";
+        std::string s = std::to_string(m->id) + ":";
+        for(auto it = m->first; it != m->last; ++it)
+        {
+            if(it != m->first)
+                s.push_back('/');
+            s.append((*it).data(), (*it).size());
+        }
+        return s;
+    }
+
+    void
+    testFind()
+    {
+        mount_table mt;
+        BOOST_TEST_EQ(mt.size(), 0);
+        BOOST_TEST_EQ(find(mt, "/a"), "none");
+        BOOST_TEST_EQ(find(mt, ""), "none");
+
+        BOOST_TEST_EQ(mt.add("/static"), 0);
+        BOOST_TEST_EQ(mt.add("/static/img/"), 1);
+        BOOST_TEST_EQ(mt.add("/a%20b"), 2);
+        BOOST_TEST_EQ(mt.add("/x/y/z"), 3);
+        BOOST_TEST_EQ(mt.size(), 4);
+
+        // duplicates
+        BOOST_TEST_EQ(mt.add("/static/"), 0);
+        BOOST_TEST_EQ(mt.add("/static/im%67"), 1);
+        BOOST_TEST_EQ(mt.size(), 4);
+
+        BOOST_TEST_EQ(find(mt, "/static"), "0:");
+        BOOST_TEST_EQ(find(mt, "/static/"), "0:");
+        BOOST_TEST_EQ(find(mt, "/static/css/a.css"), "0:css/a.css");
+        BOOST_TEST_EQ(find(mt, "/static/img"), "1:");
+        BOOST_TEST_EQ(find(mt, "/static/img/a/b.png"), "1:a/b.png");
+        BOOST_TEST_EQ(find(mt, "/static/%69mg/b.png"), "1:b.png");
+        BOOST_TEST_EQ(find(mt, "static/img/b.png"), "1:b.png");
+        BOOST_TEST_EQ(find(mt, "/staticx/img"), "none");
+        BOOST_TEST_EQ(find(mt, "/Static"), "none");
+        BOOST_TEST_EQ(find(mt, "/a%20b/c"), "2:c");
+
+        // no partial prefix
+        BOOST_TEST_EQ(find(mt, "/x/y"), "none");
+        BOOST_TEST_EQ(find(mt, "/x/y/z/w"), "3:w");
+
+        // a mount for every path
+        BOOST_TEST_EQ(mt.add("/"), 4);
+        BOOST_TEST_EQ(mt.add(""), 4);
+        BOOST_TEST_EQ(find(mt, "/x/y"), "4:x/y");
+        BOOST_TEST_EQ(find(mt, "/"), "4:");
+        BOOST_TEST_EQ(find(mt, "/x/y/z"), "3:");
+
+        BOOST_TEST_THROWS(
+            mt.add("/%zz"),
+            system::system_error);
+    }
+
+    void
+    testMany()
+    {
+        mount_table mt;
+        for(int i = 0; i < 400; ++i)
+            mt.add("/m" + std::to_string(i) +
+                "/" + std::to_string(i % 10));
+        BOOST_TEST_EQ(mt.size(), 400);
+        BOOST_TEST_GT(mt.memory_usage(), 0);
+        for(int i = 0; i < 400; i += 37)
+        {
+            auto const p = "/m" + std::to_string(i) +
+                "/" + std::to_string(i % 10) + "/f.txt";
+            BOOST_TEST_EQ(find(mt, p),
+                std::to_string(i) + ":f.txt");
+        }
+        BOOST_TEST_EQ(find(mt, "/m5/6/f.txt"), "none");
+
+        // a url
+        url u("http://example.com/m12/2/dir/f.txt?q");
+        auto m = mt.find(u.encoded_segments());
+        BOOST_TEST(m);
+        BOOST_TEST_EQ(m->id, 12);
+        BOOST_TEST_EQ(std::distance(m->first, m->last), 2);
+        BOOST_TEST_EQ(*m->first, "dir");
+    }
+
+    void
+    testJavadocs()
+    {
+        // mount_table
+        {
+        mount_table mt;
+        auto id0 = mt.add( "/" );
+        auto id1 = mt.add( "/static/img" );
+
+        url_view u( "/static/img/logo%20big.png" );
+        auto m = mt.find( u.encoded_segments() );
+
+        assert( m && m->id == id1 );
+        assert( *m->first == "logo%20big.png" && std::next( m->first ) == m->last );
+        assert( mt.find( url_view( "/static/css/site.css" ).encoded_segments() )->id == id0 );
+        }
+    }
+
+    void
+    run()
+    {
+        testFind();
+        testMany();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    mount_table_test,
+    "boost.url.mount_table");
+
+} // urls
+} // boost
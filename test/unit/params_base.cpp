@@ -342,6 +342,27 @@ struct params_base_test
         check( "?&key=value", { {}, { "key", "value" } } );
     }
 
+    void
+    testGetAs()
+    {
+        url_view u("?limit=50&offset=%31000&neg=-7&ratio=0.5&debug=on&flag&bad=x&sp=+1");
+        params_view p = u.params();
+        BOOST_TEST_EQ(p.get_as<std::size_t>("limit").value(), 50u);
+        BOOST_TEST_EQ(p.get_as<unsigned>("offset").value(), 1000u);
+        BOOST_TEST_EQ(p.get_as<int>("neg").value(), -7);
+        BOOST_TEST_EQ(p.get_as<double>("ratio").value(), 0.5);
+        BOOST_TEST_EQ(p.get_as<bool>("debug").value(), true);
+        BOOST_TEST_EQ(p.get_as<int>("LIMIT", ignore_case).value(), 50);
+        BOOST_TEST_EQ(p.get_as<int>("LIMIT").error(), grammar::error::mismatch);
+        BOOST_TEST_EQ(p.get_as<int>("missing").error(), grammar::error::mismatch);
+        BOOST_TEST_EQ(p.get_as<int>("flag").error(), grammar::error::mismatch);
+        BOOST_TEST(p.get_as<int>("bad").has_error());
+        // plus is a space in params_view
+        BOOST_TEST(p.get_as<int>("sp").has_error());
+        BOOST_TEST_EQ(p.get_as<unsigned char>("limit").value(), 50);
+        BOOST_TEST_EQ(p.get_as<unsigned char>("offset").error(), grammar::error::out_of_range);
+    }
+
     void
     testJavadocs()
     {
@@ -410,6 +431,7 @@ struct params_base_test
         testObservers();
         testIterator();
         testRange();
+        testGetAs();
         testJavadocs();
     }
 };
@@ -342,6 +342,23 @@ struct params_encoded_base_test
         check( "?&key=value", { {}, { "key", "value" } } );
     }
 
+    void
+    testGetAs()
+    {
+        url_view u("?limit=50&%6Fffset=%31000&neg=-7&ratio=1e3&debug=FALSE&flag&sp=+1");
+        params_encoded_view p = u.encoded_params();
+        BOOST_TEST_EQ(p.get_as<std::size_t>("limit").value(), 50u);
+        BOOST_TEST_EQ(p.get_as<unsigned>("offset").value(), 1000u);
+        BOOST_TEST_EQ(p.get_as<unsigned>("%6Fffset").value(), 1000u);
+        BOOST_TEST_EQ(p.get_as<long>("neg").value(), -7);
+        BOOST_TEST_EQ(p.get_as<float>("ratio").value(), 1000.f);
+        BOOST_TEST_EQ(p.get_as<bool>("debug").value(), false);
+        BOOST_TEST_EQ(p.get_as<int>("missing").error(), grammar::error::mismatch);
+        BOOST_TEST_EQ(p.get_as<int>("flag").error(), grammar::error::mismatch);
+        // plus is not decoded
+        BOOST_TEST_EQ(p.get_as<int>("sp").value(), 1);
+    }
+
     void
     testJavadocs()
     {
@@ -405,6 +422,7 @@ struct params_encoded_base_test
         testObservers();
         testIterator();
         testRange();
+        testGetAs();
         testJavadocs();
     }
 };
@@ -0,0 +1,188 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/params_encoded_index.hpp>
+
+#include <boost/url/parse.hpp>
+#include <boost/url/parse_query.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/core/ignore_unused.hpp>
+#include <iterator>
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+BOOST_STATIC_ASSERT(
+    std::is_default_constructible<
+        params_encoded_index>::value);
+
+BOOST_STATIC_ASSERT(
+    std::is_copy_constructible<
+        params_encoded_index>::value);
+
+BOOST_STATIC_ASSERT(
+    std::is_same<
+        std::iterator_traits<
+            params_encoded_index::iterator
+                >::iterator_category,
+        std::random_access_iterator_tag>::value);
+
+struct params_encoded_index_test
+{
+    static
+    void
+    check(params_encoded_view qp)
+    {
+        params_encoded_index const ix(qp);
+        BOOST_TEST_EQ(ix.size(), qp.size());
+        BOOST_TEST_EQ(ix.empty(), qp.empty());
+        BOOST_TEST_EQ(
+            ix.buffer().data(), qp.buffer().data());
+        std::size_t i = 0;
+        for(auto it = qp.begin(); it != qp.end(); ++it, ++i)
+        {
+            param_pct_view p0 = *it;
+            param_pct_view p1 = ix[i];
+            BOOST_TEST_EQ(p0.key, p1.key);
+            BOOST_TEST_EQ(p0.key.data(), p1.key.data());
+            BOOST_TEST_EQ(
+                p0.key.decoded_size(), p1.key.decoded_size());
+            BOOST_TEST_EQ(p0.has_value, p1.has_value);
+            BOOST_TEST_EQ(p0.value, p1.value);
+            BOOST_TEST_EQ(
+                p0.value.decoded_size(), p1.value.decoded_size());
+            BOOST_TEST_EQ((ix.begin() + i)->key, p0.key);
+            BOOST_TEST_EQ(ix.offset(i), static_cast<
+                std::size_t>(p0.key.data() - qp.buffer().data()));
+            std::size_t n = p0.key.size();
+            if(p0.has_value)
+                n += 1 + p0.value.size();
+            for(std::size_t j = 0; j < n; ++j)
+                BOOST_TEST_EQ(
+                    ix.locate(ix.offset(i) + j) - ix.begin(),
+                    static_cast<std::ptrdiff_t>(i));
+        }
+        if(! ix.empty())
+        {
+            BOOST_TEST_EQ(ix.front().key, (*qp.begin()).key);
+            BOOST_TEST_EQ(ix.back().key, (*--qp.end()).key);
+        }
+        BOOST_TEST(ix.locate(qp.buffer().size()) == ix.end());
+    }
+
+    void
+    testIndex()
+    {
+        char const* const queries[] = {
+            "",
+            "?",
+            "?&",
+            "?=",
+            "?a",
+            "?a=",
+            "?a=1",
+            "?a=1&",
+            "?a=1&b",
+            "?a=1&b=2&c=3",
+            "?a==1&&b=%32&%63=3",
+            "?first=John&last=Doe",
+        };
+        for(auto s : queries)
+        {
+            url u = parse_uri_reference(s).value();
+            check(u.encoded_params());
+            check(url_view(u).encoded_params());
+            if(*s)
+                check(parse_query(s + 1).value());
+        }
+    }
+
+    void
+    testIterator()
+    {
+        params_encoded_index const ix(
+            parse_query("a=1&b=2&c=3&d=4").value());
+        auto it = ix.begin();
+        BOOST_TEST_EQ(it[3].key, "d");
+        it += 2;
+        BOOST_TEST_EQ(it->value, "3");
+        it -= 1;
+        BOOST_TEST_EQ(it->value, "2");
+        BOOST_TEST_EQ((1 + it)->key, "c");
+        BOOST_TEST_EQ((it - 1)->key, "a");
+        BOOST_TEST_EQ(ix.end() - it, 3);
+        BOOST_TEST(ix.begin() < it);
+        BOOST_TEST(it >= ix.begin());
+
+        // default
+        params_encoded_index ix0;
+        BOOST_TEST(ix0.empty());
+        BOOST_TEST(ix0.begin() == ix0.end());
+        BOOST_TEST(ix0.locate(0) == ix0.end());
+    }
+
+    void
+    testJavadocs()
+    {
+        // params_encoded_index
+        {
+        url_view u( "?first=John&last=Doe&age=42" );
+        params_encoded_index qp( u.encoded_params() );
+
+        assert( qp[2].value == "42" );
+        assert( (qp.begin() + 1)->key == "last" );
+        }
+
+        // params_encoded_index(params_encoded_view)
+        {
+        params_encoded_index qp( parse_query( "first=John&last=Doe" ).value() );
+
+        ignore_unused(qp);
+        }
+
+        // offset()
+        {
+        params_encoded_index qp( parse_query( "first=John&last=Doe" ).value() );
+
+        assert( qp.offset( 1 ) == 11 );
+        }
+
+        // locate()
+        {
+        params_encoded_index qp( parse_query( "first=John&last=Doe" ).value() );
+
+        assert( qp.locate( 13 )->key == "last" );
+        }
+    }
+
+    void
+    run()
+    {
+        testIndex();
+        testIterator();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    params_encoded_index_test,
+    "boost.url.params_encoded_index");
+
+} // urls
+} // boost
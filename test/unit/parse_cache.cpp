@@ -0,0 +1,300 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/parse_cache.hpp>
+
+#include <boost/url/parse.hpp>
+#include <boost/url/url_hash.hpp>
+#include <boost/url/url_view.hpp>
+#include <string>
+#include <vector>
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <thread>
+#endif
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct parse_cache_test
+{
+    static
+    std::string
+    make(std::size_t i)
+    {
+        return "/path/" + std::to_string(i % 13) +
+            "/" + std::to_string(i) +
+            "?q=" + std::to_string(i * 7);
+    }
+
+    // check that the view is the same
+    // as one returned by the parser
+    static
+    void
+    check(
+        system::result<url_view> const& rv,
+        core::string_view s)
+    {
+        auto const rv0 = parse_origin_form(s);
+        if(! BOOST_TEST_EQ(
+                rv.has_value(), rv0.has_value()))
+            return;
+        if(! rv)
+        {
+            BOOST_TEST(rv.error() == rv0.error());
+            return;
+        }
+        url_view const& u = *rv;
+        url_view const& u0 = *rv0;
+        BOOST_TEST_EQ(u.data(), s.data());
+        BOOST_TEST_EQ(u.buffer(), u0.buffer());
+        BOOST_TEST_EQ(u.encoded_path(), u0.encoded_path());
+        BOOST_TEST_EQ(u.segments().size(), u0.segments().size());
+        BOOST_TEST_EQ(u.has_query(), u0.has_query());
+        BOOST_TEST_EQ(u.encoded_query(), u0.encoded_query());
+        BOOST_TEST_EQ(u.params().size(), u0.params().size());
+        BOOST_TEST_EQ(u.path(), u0.path());
+        BOOST_TEST_EQ(u.query(), u0.query());
+        BOOST_TEST(u == u0);
+    }
+
+    void
+    testParse()
+    {
+        parse_cache c;
+        BOOST_TEST_EQ(c.capacity(), 4096u);
+        BOOST_TEST_EQ(c.hits(), 0u);
+        BOOST_TEST_EQ(c.misses(), 0u);
+
+        core::string_view const v[] = {
+            "/",
+            "/index.htm",
+            "/a/b/c?x=1&y=2",
+            "/%7Euser/./a/../b?k=%20v",
+            "/a;p=1/b?",
+            "//x",
+            "?q",
+            "",
+            "/a b",
+            };
+
+        // the characters of each string are
+        // copied to new storage every time
+        for(int pass = 0; pass < 3; ++pass)
+        {
+            for(auto s0 : v)
+            {
+                std::string s(s0);
+                check(c.parse_origin_form(s), s);
+            }
+        }
+        // the last three are invalid,
+        // and are not stored
+        BOOST_TEST_EQ(c.hits(), 12u);
+        BOOST_TEST_EQ(c.misses(), 15u);
+
+        c.clear();
+        BOOST_TEST_EQ(c.hits(), 0u);
+        BOOST_TEST_EQ(c.misses(), 0u);
+        std::string s("/index.htm");
+        check(c.parse_origin_form(s), s);
+        BOOST_TEST_EQ(c.misses(), 1u);
+    }
+
+    void
+    testDigest()
+    {
+        parse_cache c;
+        std::string const s = "/A/%7e/./b?x=%41";
+        std::size_t const h0 = url_hash()(url_view(s));
+        std::size_t h = 0;
+
+        // stored without the digest
+        check(c.parse_origin_form(s), s);
+        auto rv = c.parse_origin_form(s, h);
+        check(rv, s);
+        BOOST_TEST_EQ(h, h0);
+        h = 0;
+        rv = c.parse_origin_form(s, h);
+        check(rv, s);
+        BOOST_TEST_EQ(h, h0);
+        BOOST_TEST_EQ(c.hits(), 2u);
+
+        // stored with the digest
+        std::string const s1 = "/x/y";
+        h = 0;
+        rv = c.parse_origin_form(s1, h);
+        check(rv, s1);
+        BOOST_TEST_EQ(h, url_hash()(url_view(s1)));
+        h = 0;
+        rv = c.parse_origin_form(s1, h);
+        BOOST_TEST_EQ(h, url_hash()(url_view(s1)));
+
+        // invalid strings leave the
+        // digest unchanged
+        h = 1;
+        rv = c.parse_origin_form("a:b", h);
+        BOOST_TEST(rv.has_error());
+        BOOST_TEST_EQ(h, 1u);
+    }
+
+    void
+    testEviction()
+    {
+        parse_cache::options opt;
+        opt.capacity = 16;
+        opt.shards = 1;
+        opt.max_size = 16;
+        parse_cache c(opt);
+        BOOST_TEST_EQ(c.capacity(), 16u);
+
+        // more strings than entries
+        for(int pass = 0; pass < 2; ++pass)
+            for(std::size_t i = 0; i < 100; ++i)
+            {
+                auto const s = "/" + std::to_string(i);
+                check(c.parse_origin_form(s), s);
+            }
+        BOOST_TEST_EQ(c.hits() + c.misses(), 200u);
+        BOOST_TEST_LE(c.hits(), 16u);
+
+        // a string used often stays
+        c.clear();
+        std::string const hot = "/hot";
+        check(c.parse_origin_form(hot), hot);
+        for(std::size_t i = 0; i < 1000; ++i)
+        {
+            auto const s = "/" + std::to_string(i);
+            check(c.parse_origin_form(s), s);
+            check(c.parse_origin_form(hot), hot);
+        }
+        BOOST_TEST_GE(c.hits(), 1000u);
+
+        // longer strings are not stored
+        c.clear();
+        std::string const big =
+            "/a-string-longer-than-max-size";
+        check(c.parse_origin_form(big), big);
+        check(c.parse_origin_form(big), big);
+        std::size_t h = 0;
+        check(c.parse_origin_form(big, h), big);
+        BOOST_TEST_EQ(h, url_hash()(url_view(big)));
+        BOOST_TEST_EQ(c.hits(), 0u);
+        BOOST_TEST_EQ(c.misses(), 3u);
+
+        // rounding
+        opt.capacity = 100;
+        opt.shards = 3;
+        BOOST_TEST_EQ(parse_cache(opt).capacity(), 128u);
+
+        opt.capacity = 0;
+        BOOST_TEST_THROWS(parse_cache{opt},
+            system::system_error);
+        opt.capacity = 1;
+        opt.shards = 0;
+        BOOST_TEST_THROWS(parse_cache{opt},
+            system::system_error);
+    }
+
+    void
+    testThreads()
+    {
+#if !defined(BOOST_URL_DISABLE_THREADS)
+        parse_cache::options opt;
+        opt.capacity = 256;
+        opt.shards = 4;
+        parse_cache c(opt);
+        std::vector<std::string> v;
+        for(std::size_t i = 0; i < 400; ++i)
+            v.push_back(make(i));
+        std::vector<std::thread> threads;
+        std::vector<int> ok(4, 1);
+        for(std::size_t t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&c, &v, &ok, t]
+            {
+                for(std::size_t n = 0; n < 5000; ++n)
+                {
+                    // skewed towards the first strings
+                    std::size_t const i =
+                        (n * 7919 + t) % (n % 3 ? 40 : 400);
+                    std::string s = v[i];
+                    std::size_t h = 0;
+                    auto rv = (n % 2) ?
+                        c.parse_origin_form(s) :
+                        c.parse_origin_form(s, h);
+                    if( ! rv ||
+                        rv->buffer() != v[i] ||
+                        rv->data() != s.data() ||
+                        rv->encoded_query() !=
+                            parse_origin_form(v[i])->encoded_query() ||
+                        ((n % 2) == 0 &&
+                            h != url_hash()(url_view(v[i]))))
+                        ok[t] = 0;
+                }
+            });
+        }
+        for(auto& th : threads)
+            th.join();
+        for(auto b : ok)
+            BOOST_TEST_EQ(b, 1);
+        BOOST_TEST_EQ(c.hits() + c.misses(), 20000u);
+        BOOST_TEST_GT(c.hits(), 10000u);
+#endif
+    }
+
+    void
+    testJavadocs()
+    {
+        // parse_cache
+        {
+        parse_cache cache;
+
+        auto rv = cache.parse_origin_form( "/index.htm?page=2" );
+        assert( rv && rv->encoded_path() == "/index.htm" );
+
+        rv = cache.parse_origin_form( "/index.htm?page=2" );
+        assert( rv && cache.hits() == 1 );
+        }
+
+        // parse_origin_form
+        {
+        parse_cache cache;
+        std::size_t h;
+
+        auto rv = cache.parse_origin_form( "/%7Euser/./a", h );
+        assert( rv && h == url_hash()( url_view( "/~user/a" ) ) );
+        }
+    }
+
+    void
+    run()
+    {
+        testParse();
+        testDigest();
+        testEviction();
+        testThreads();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    parse_cache_test,
+    "boost.url.parse_cache");
+
+} // urls
+} // boost
@@ -0,0 +1,279 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/resolve_into.hpp>
+
+#include <boost/url/error.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <string>
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct resolve_into_test
+{
+    // check that both overloads produce
+    // the same string as resolve
+    static
+    void
+    check(
+        core::string_view b,
+        core::string_view r)
+    {
+        auto const ub = parse_uri_reference(b).value();
+        auto const ur = parse_uri_reference(r).value();
+        url u;
+        auto const rv0 = resolve(ub, ur, u);
+        if(! BOOST_TEST(rv0.has_value()))
+            return;
+
+        char buf[256];
+        auto const rv1 = resolve_into(
+            ub, ur, buf, sizeof(buf));
+        if(! BOOST_TEST(rv1.has_value()))
+            return;
+        BOOST_TEST_EQ(
+            core::string_view(buf, *rv1),
+            u.buffer());
+
+        static_url<256> su("x://y");
+        auto const rv2 = resolve_into(ub, ur, su);
+        if(! BOOST_TEST(rv2.has_value()))
+            return;
+        BOOST_TEST_EQ(su.buffer(), u.buffer());
+        BOOST_TEST_EQ(su.c_str()[su.size()], '\0');
+
+        // the parts match those of the
+        // string, which is parsed again
+        // because resolve may leave "//"
+        // at the start of a path with no
+        // authority, as in "x:" and "..//g"
+        url_view const v(u.buffer());
+        BOOST_TEST_EQ(su.scheme(), v.scheme());
+        BOOST_TEST_EQ(su.has_authority(), v.has_authority());
+        BOOST_TEST_EQ(su.encoded_authority(), v.encoded_authority());
+        BOOST_TEST_EQ(su.encoded_path(), v.encoded_path());
+        BOOST_TEST_EQ(su.segments().size(), v.segments().size());
+        BOOST_TEST_EQ(su.has_query(), v.has_query());
+        BOOST_TEST_EQ(su.encoded_query(), v.encoded_query());
+        BOOST_TEST_EQ(su.has_fragment(), v.has_fragment());
+        BOOST_TEST_EQ(su.encoded_fragment(), v.encoded_fragment());
+    }
+
+    void
+    testResolve()
+    {
+        core::string_view const bases[] = {
+            "http://a/b/c/d;p?q",
+            "http://a/b/c/d;p?q#f",
+            "http://a",
+            "http://a/",
+            "http://a?q",
+            "http://a#f",
+            "http://u:p@a:80/b//c/",
+            "HTTP://a/%7Eb/%2e%2E/c",
+            "x:",
+            "x:a",
+            "x:a/b",
+            "x:a/b/",
+            "x:/",
+            "x:/a",
+            "x:/a/b?q#f",
+            "x:/.//a/b",
+            "x:/./a",
+            "x:a/../b",
+            "x:%41/%2f/%7e",
+            "x:./a",
+            "x:/.",
+            "x:.//a/",
+            "file:///c/d",
+            "mailto:user@example.com",
+            };
+        core::string_view const refs[] = {
+            "",
+            "g:h",
+            "http:g",
+            "http:",
+            "http:?y",
+            "HTTP://g/a",
+            "https://g/./a/../b?q#f",
+            "x:g/./h",
+            "g",
+            "./g",
+            "g/",
+            "/g",
+            "//g",
+            "//g?q#f",
+            "//g/a/../a",
+            "//u@g:8080",
+            "//g/%7e%2fh",
+            "?y",
+            "?",
+            "#",
+            "#s",
+            "?y#s",
+            "g?y#s",
+            ";x",
+            ".",
+            "./",
+            "..",
+            "../",
+            "../g",
+            "../..",
+            "../../../g",
+            "../../../../g",
+            "/./g",
+            "/../g",
+            "/.//g",
+            "/././/g",
+            "/./.",
+            ".//g",
+            "././/g",
+            "..//g",
+            "%2E//g",
+            "g//",
+            "g/../..//h",
+            "g.",
+            "..g",
+            "%2E%2E",
+            "%2e/%2E%2e/g",
+            "a%2fb/../c",
+            "%7e%7E%41%25",
+            "g;x=1/../y",
+            "g?y/./x",
+            "g#s/../x",
+            "a//b//../c",
+            // the parser accepts a path after
+            // the authority without a '/'
+            "//h:x/y",
+            "//h:x",
+            "//h:x/../y",
+            "//u@h:a./b",
+            "//h:%2E%2E/g",
+            ".//..",
+            ".//g",
+            ".//./g",
+            };
+        for(auto b : bases)
+            for(auto r : refs)
+                check(b, r);
+    }
+
+    void
+    testErrors()
+    {
+        // not a base
+        {
+            char buf[64];
+            auto rv = resolve_into(
+                url_view("/a/b"), url_view("c"),
+                buf, sizeof(buf));
+            BOOST_TEST(rv.error() == error::not_a_base);
+
+            static_url<64> u("x://y");
+            auto rv2 = resolve_into(
+                url_view("a/b"), url_view("c"), u);
+            BOOST_TEST(rv2.error() == error::not_a_base);
+            BOOST_TEST_EQ(u.buffer(), "x://y");
+        }
+
+        // no space
+        {
+            url_view b("http://a/b/c/d;p?q");
+            url_view r("../g?y#s");
+            core::string_view const s = "http://a/b/g?y#s";
+
+            char buf[64];
+            auto rv = resolve_into(b, r, buf, 0);
+            BOOST_TEST(rv.error() == error::no_space);
+            rv = resolve_into(b, r, buf, 10);
+            BOOST_TEST(rv.error() == error::no_space);
+
+            // the merged string before
+            // normalization must fit
+            std::size_t const n =
+                core::string_view("http://a/b/c/../g?y#s").size();
+            rv = resolve_into(b, r, buf, n - 1);
+            BOOST_TEST(rv.error() == error::no_space);
+            rv = resolve_into(b, r, buf, n);
+            if(BOOST_TEST(rv.has_value()))
+                BOOST_TEST_EQ(core::string_view(buf, *rv), s);
+
+            static_url<16> u1("x://y");
+            auto rv1 = resolve_into(b, r, u1);
+            BOOST_TEST(rv1.error() == error::no_space);
+            BOOST_TEST_EQ(u1.buffer(), "x://y");
+
+            static_url<21> u2;
+            rv1 = resolve_into(b, r, u2);
+            BOOST_TEST(rv1.has_value());
+            BOOST_TEST_EQ(u2.buffer(), s);
+        }
+
+        // the result may then be modified
+        {
+            static_url<64> u;
+            auto rv = resolve_into(
+                url_view("http://a/b/c"),
+                url_view("d?x=1"), u);
+            BOOST_TEST(rv.has_value());
+            u.params().append({"y", "2"});
+            u.set_host("example.com");
+            BOOST_TEST_EQ(u.buffer(),
+                "http://example.com/b/d?x=1&y=2");
+        }
+    }
+
+    void
+    testJavadocs()
+    {
+        {
+        char buf[ 64 ];
+        auto rv = resolve_into(
+            url_view( "http://a/b/c/d;p?q" ),
+            url_view( "../g#s" ), buf, sizeof( buf ) );
+
+        assert( rv && core::string_view( buf, *rv ) == "http://a/b/g#s" );
+        }
+
+        {
+        static_url< 64 > dest;
+        auto rv = resolve_into(
+            url_view( "http://a/b/c/d;p?q" ),
+            url_view( "g?y" ), dest );
+
+        assert( rv && dest.buffer() == "http://a/b/c/g?y" );
+        }
+    }
+
+    void
+    run()
+    {
+        testResolve();
+        testErrors();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    resolve_into_test,
+    "boost.url.resolve_into");
+
+} // urls
+} // boost
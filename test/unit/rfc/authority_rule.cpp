@@ -14,6 +14,7 @@
 
 #include "test_rule.hpp"
 
+#include <cstring>
 #include <type_traits>
 
 namespace boost {
@@ -22,9 +23,82 @@ namespace urls {
 class authority_rule_test
 {
 public:
+    static
+    void
+    check_host(
+        core::string_view s,
+        host_type ht,
+        core::string_view host,
+        std::size_t dn)
+    {
+        auto rv = grammar::parse(s, authority_rule);
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        BOOST_TEST(rv->host_type() == ht);
+        BOOST_TEST_EQ(rv->encoded_host(), host);
+        BOOST_TEST_EQ(
+            rv->encoded_host().decoded_size(), dn);
+    }
+
+    void
+    testHost()
+    {
+        auto const ipv4 = host_type::ipv4;
+        auto const name = host_type::name;
+
+        check_host("1.2.3.4", ipv4, "1.2.3.4", 7);
+        check_host("0.0.0.0", ipv4, "0.0.0.0", 7);
+        check_host("255.255.255.255", ipv4, "255.255.255.255", 15);
+        check_host("1.2.3.4:80", ipv4, "1.2.3.4", 7);
+        check_host("u@1.2.3.4:", ipv4, "1.2.3.4", 7);
+        check_host("256.1.1.1", name, "256.1.1.1", 9);
+        check_host("1.2.3.256", name, "1.2.3.256", 9);
+        check_host("1.2.3.2555", name, "1.2.3.2555", 10);
+        check_host("01.2.3.4", name, "01.2.3.4", 8);
+        check_host("1.2.3.04", name, "1.2.3.04", 8);
+        check_host("1.2.3", name, "1.2.3", 5);
+        check_host("1.2.3.", name, "1.2.3.", 6);
+        check_host("1..2.3", name, "1..2.3", 6);
+        check_host("1.2.3.4.", name, "1.2.3.4.", 8);
+        check_host("1.2.3.4.5", name, "1.2.3.4.5", 9);
+        check_host("1.2.3.4a", name, "1.2.3.4a", 8);
+        check_host("1.2.3.4-", name, "1.2.3.4-", 8);
+        check_host("1.2.3.4%41", name, "1.2.3.4%41", 8);
+        check_host("1%2e2.3.4", name, "1%2e2.3.4", 7);
+        check_host("a%41b", name, "a%41b", 3);
+        check_host("www.example.com", name, "www.example.com", 15);
+        check_host("12345", name, "12345", 5);
+
+        {
+            auto rv = grammar::parse("10.0.0.255", authority_rule);
+            if(BOOST_TEST(rv.has_value()))
+                BOOST_TEST_EQ(rv->host_ipv4_address(),
+                    ipv4_address(0x0a0000ff));
+        }
+
+        // an IPv4address followed by a bad
+        // escape is not part of the host
+        {
+            char const* const s = "1.2.3.4%zz";
+            char const* it = s;
+            auto rv = authority_rule.parse(
+                it, s + std::strlen(s));
+            if(BOOST_TEST(rv.has_value()))
+            {
+                BOOST_TEST(rv->host_type() == ipv4);
+                BOOST_TEST_EQ(it, s + 7);
+            }
+        }
+
+        bad(authority_rule, "a%4");
+        bad(authority_rule, "a%zz");
+    }
+
     void
     run()
     {
+        testHost();
+
         // javadoc
         {
             system::result< authority_view > rv = grammar::parse( "user:pass@example.com:8080", authority_rule );
@@ -0,0 +1,213 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/segments_encoded_index.hpp>
+
+#include <boost/url/parse.hpp>
+#include <boost/url/parse_path.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/core/ignore_unused.hpp>
+#include <algorithm>
+#include <iterator>
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+BOOST_STATIC_ASSERT(
+    std::is_default_constructible<
+        segments_encoded_index>::value);
+
+BOOST_STATIC_ASSERT(
+    std::is_copy_constructible<
+        segments_encoded_index>::value);
+
+BOOST_STATIC_ASSERT(
+    std::is_same<
+        std::iterator_traits<
+            segments_encoded_index::iterator
+                >::iterator_category,
+        std::random_access_iterator_tag>::value);
+
+struct segments_encoded_index_test
+{
+    static
+    void
+    check(segments_encoded_view ps)
+    {
+        segments_encoded_index const ix(ps);
+        BOOST_TEST_EQ(ix.size(), ps.size());
+        BOOST_TEST_EQ(ix.empty(), ps.empty());
+        BOOST_TEST_EQ(
+            ix.buffer().data(), ps.buffer().data());
+        BOOST_TEST_EQ(
+            ix.end() - ix.begin(),
+            static_cast<std::ptrdiff_t>(ps.size()));
+        std::size_t i = 0;
+        for(auto it = ps.begin(); it != ps.end(); ++it, ++i)
+        {
+            pct_string_view s0 = *it;
+            pct_string_view s1 = ix[i];
+            BOOST_TEST_EQ(s0, s1);
+            BOOST_TEST_EQ(s0.data(), s1.data());
+            BOOST_TEST_EQ(
+                s0.decoded_size(), s1.decoded_size());
+            BOOST_TEST_EQ(*(ix.begin() + i), s0);
+            BOOST_TEST_EQ(*(ix.end() - (ps.size() - i)), s0);
+            BOOST_TEST_EQ(ix.offset(i), static_cast<
+                std::size_t>(s0.data() - ps.buffer().data()));
+            // every position in the
+            // segment locates it
+            for(std::size_t j = 0; j < s0.size(); ++j)
+                BOOST_TEST_EQ(
+                    ix.locate(ix.offset(i) + j) - ix.begin(),
+                    static_cast<std::ptrdiff_t>(i));
+        }
+        if(! ix.empty())
+        {
+            BOOST_TEST_EQ(ix.front(), ps.front());
+            BOOST_TEST_EQ(ix.back(), ps.back());
+        }
+        BOOST_TEST(ix.locate(ps.buffer().size()) == ix.end());
+        BOOST_TEST(std::equal(
+            ix.begin(), ix.end(), ps.begin()));
+    }
+
+    void
+    testIndex()
+    {
+        char const* const paths[] = {
+            "",
+            "/",
+            "//",
+            "./",
+            "/./",
+            "a",
+            "a/",
+            "/a",
+            "/a/",
+            "a/b",
+            "/a/b/",
+            "//a//b//",
+            "/path/to/file.txt",
+            "/%70ath/t%6F/f%69le.txt",
+            "path:to:file",
+            "./path:to:file",
+            "/.//path",
+        };
+        for(auto s : paths)
+        {
+            check(parse_path(s).value());
+            url u = parse_uri_reference(s).value();
+            check(u.encoded_segments());
+            check(url_view(u).encoded_segments());
+        }
+        check(url_view("http://example.com/a/b/c").encoded_segments());
+        check(url_view("http://example.com").encoded_segments());
+    }
+
+    void
+    testIterator()
+    {
+        segments_encoded_index const ix(
+            parse_path("/a/b/c/d").value());
+        auto it = ix.begin();
+        BOOST_TEST_EQ(it[3], "d");
+        it += 2;
+        BOOST_TEST_EQ(*it, "c");
+        it -= 1;
+        BOOST_TEST_EQ(*it, "b");
+        BOOST_TEST_EQ(*(1 + it), "c");
+        BOOST_TEST_EQ(*(it - 1), "a");
+        BOOST_TEST_EQ(*it++, "b");
+        BOOST_TEST_EQ(*it--, "c");
+        BOOST_TEST_EQ(*--it, "a");
+        BOOST_TEST_EQ(*++it, "b");
+        BOOST_TEST_EQ(it->size(), 1u);
+        BOOST_TEST(ix.begin() < it);
+        BOOST_TEST(ix.begin() <= it);
+        BOOST_TEST(it > ix.begin());
+        BOOST_TEST(it >= ix.begin());
+        BOOST_TEST(it != ix.begin());
+        BOOST_TEST(ix.begin() == ix.begin());
+
+        // binary search over the segments
+        auto const p = std::lower_bound(
+            ix.begin(), ix.end(), core::string_view("c"),
+            [](pct_string_view a, core::string_view b)
+            {
+                return a < b;
+            });
+        BOOST_TEST_EQ(p - ix.begin(), 2);
+
+        // default
+        segments_encoded_index ix0;
+        BOOST_TEST(ix0.empty());
+        BOOST_TEST(ix0.begin() == ix0.end());
+        BOOST_TEST(ix0.locate(0) == ix0.end());
+    }
+
+    void
+    testJavadocs()
+    {
+        // segments_encoded_index
+        {
+        url_view u( "/path/to/file.txt" );
+        segments_encoded_index ps( u.encoded_segments() );
+
+        assert( ps[2] == "file.txt" );
+        assert( *(ps.begin() + 1) == "to" );
+        }
+
+        // segments_encoded_index(segments_encoded_view)
+        {
+        segments_encoded_index ps( parse_path( "/path/to/file.txt" ).value() );
+
+        ignore_unused(ps);
+        }
+
+        // offset()
+        {
+        segments_encoded_index ps( parse_path( "/path/to/file.txt" ).value() );
+
+        assert( ps.offset( 1 ) == 6 );
+        }
+
+        // locate()
+        {
+        segments_encoded_index ps( parse_path( "/path/to/file.txt" ).value() );
+
+        assert( *ps.locate( 7 ) == "to" );
+        }
+    }
+
+    void
+    run()
+    {
+        testIndex();
+        testIterator();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    segments_encoded_index_test,
+    "boost.url.segments_encoded_index");
+
+} // urls
+} // boost
@@ -0,0 +1,212 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/shared_url.hpp>
+
+#include <boost/url/parse.hpp>
+#include <boost/url/static_url.hpp>
+#include <boost/static_assert.hpp>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+BOOST_STATIC_ASSERT(
+    std::is_nothrow_default_constructible<
+        shared_url>::value);
+
+BOOST_STATIC_ASSERT(
+    std::is_nothrow_copy_constructible<
+        shared_url>::value);
+
+BOOST_STATIC_ASSERT(
+    std::is_nothrow_copy_assignable<
+        shared_url>::value);
+
+BOOST_STATIC_ASSERT(
+    std::is_convertible<
+        shared_url, url_view>::value);
+
+BOOST_STATIC_ASSERT(
+    std::is_convertible<
+        url_view, shared_url>::value);
+
+struct shared_url_test
+{
+    static
+    core::string_view
+    host_of(url_view_base const& u)
+    {
+        return u.encoded_host();
+    }
+
+    void
+    testSpecial()
+    {
+        // shared_url()
+        {
+            shared_url su;
+            BOOST_TEST(su->empty());
+            BOOST_TEST_EQ(su.get().buffer(), "");
+            BOOST_TEST_EQ(su.use_count(), 0);
+        }
+
+        // shared_url(core::string_view)
+        {
+            BOOST_TEST_THROWS(
+                shared_url("$:$"),
+                system::system_error);
+            shared_url su("http://www.example.com/path");
+            BOOST_TEST_EQ(su->buffer(),
+                "http://www.example.com/path");
+            BOOST_TEST_EQ(su->host(), "www.example.com");
+            BOOST_TEST_EQ(su.use_count(), 1);
+        }
+
+        // shared_url(url_view_base const&)
+        {
+            std::string s = "http://www.example.com/path";
+            url_view u(s);
+            shared_url su(u);
+            BOOST_TEST_NE(su->data(), s.data());
+            s = "xxxxxxxxxxxxxxxxxxxxxxxxxxx";
+            BOOST_TEST_EQ(su->buffer(),
+                "http://www.example.com/path");
+
+            shared_url su2(static_url<64>("/a/b"));
+            BOOST_TEST_EQ(su2->buffer(), "/a/b");
+            BOOST_TEST_EQ(su2->segments().size(), 2u);
+        }
+
+        // shared_url(shared_url const&)
+        // operator=(shared_url const&)
+        {
+            shared_url su("http://www.example.com");
+            shared_url su2(su);
+            BOOST_TEST_EQ(su2->data(), su->data());
+            BOOST_TEST_EQ(su.use_count(), 2);
+            shared_url su3;
+            su3 = su2;
+            BOOST_TEST_EQ(su3->data(), su->data());
+            BOOST_TEST_EQ(su.use_count(), 3);
+            su3 = shared_url();
+            BOOST_TEST(su3->empty());
+            BOOST_TEST_EQ(su.use_count(), 2);
+        }
+
+        // shared_url(shared_url&&)
+        // operator=(shared_url&&)
+        {
+            shared_url su("http://www.example.com");
+            char const* p = su->data();
+            shared_url su2(std::move(su));
+            BOOST_TEST_EQ(su2->data(), p);
+            BOOST_TEST_EQ(su2.use_count(), 1);
+            shared_url su3;
+            su3 = std::move(su2);
+            BOOST_TEST_EQ(su3->data(), p);
+        }
+    }
+
+    void
+    testObservers()
+    {
+        shared_url su("https://user@www.example.com:8080/a/b?k=v#f");
+
+        // operator url_view const&
+        url_view const& v = su;
+        BOOST_TEST_EQ(&v, &su.get());
+        BOOST_TEST_EQ(&*su, &su.get());
+        BOOST_TEST_EQ(host_of(su), "www.example.com");
+        url_view v2 = su;
+        BOOST_TEST_EQ(v2.data(), su->data());
+        BOOST_TEST_EQ(v2.port(), "8080");
+        BOOST_TEST_EQ(su->encoded_query(), "k=v");
+        BOOST_TEST_EQ(su->fragment(), "f");
+
+        // to_url
+        url u = su.to_url();
+        u.set_host("example.org");
+        BOOST_TEST_EQ(u.host(), "example.org");
+        BOOST_TEST_EQ(su->host(), "www.example.com");
+
+        // comparison
+        shared_url su2(url_view(
+            "https://user@www.example.com:8080/a/b?k=v#f"));
+        shared_url su3("https://user@www.example.com:8080/a/c");
+        BOOST_TEST(su == su2);
+        BOOST_TEST(su != su3);
+        BOOST_TEST(su < su3);
+        BOOST_TEST(su <= su2);
+        BOOST_TEST(su3 > su);
+        BOOST_TEST(su3 >= su);
+
+        // hash
+        std::unordered_set<shared_url> set;
+        set.insert(su);
+        BOOST_TEST_EQ(set.count(su2), 1u);
+        BOOST_TEST_EQ(
+            std::hash<shared_url>()(su),
+            std::hash<url_view>()(*su));
+        BOOST_TEST_EQ(
+            std::hash<shared_url>(7)(su),
+            std::hash<url_view>(7)(*su));
+    }
+
+    void
+    testJavadocs()
+    {
+        // shared_url
+        {
+        shared_url su( "https://www.example.com/path?id=42" );
+        shared_url su2 = su;                            // no allocation
+
+        assert( su2->data() == su->data() );            // same buffer
+
+        url u( *su );                                   // copy on write
+        u.set_host( "example.org" );
+
+        assert( su->host() == "www.example.com" );      // unchanged
+        }
+
+        // to_url
+        {
+        shared_url su( "https://www.example.com" );
+        url u = su.to_url().set_scheme( "wss" );
+
+        BOOST_TEST_EQ( u.scheme(), "wss" );
+        }
+    }
+
+    void
+    run()
+    {
+        testSpecial();
+        testObservers();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    shared_url_test,
+    "boost.url.shared_url");
+
+} // urls
+} // boost
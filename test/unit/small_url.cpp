@@ -0,0 +1,246 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/small_url.hpp>
+
+#include <boost/url/parse.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/static_assert.hpp>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct small_url_test
+{
+    BOOST_STATIC_ASSERT(
+        std::is_default_constructible<
+            small_url<10>>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_copy_constructible<
+            small_url<10>>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_copy_assignable<
+            small_url<10>>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_nothrow_move_constructible<
+            small_url<10>>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_nothrow_move_assignable<
+            small_url<10>>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_convertible<
+            small_url<10>, url_view>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_convertible<
+            small_url<10>, url>::value);
+
+    void
+    testSpecial()
+    {
+        // small_url()
+        {
+            small_url<16> u;
+            BOOST_TEST_EQ(*u.c_str(), '\0');
+            BOOST_TEST(u.buffer().empty());
+            BOOST_TEST(u.is_inline());
+            BOOST_TEST_EQ(u.capacity(), 16u);
+        }
+
+        // small_url(core::string_view)
+        {
+            BOOST_TEST_THROWS(
+                small_url<16>("$:$"),
+                system::system_error);
+
+            small_url<32> u0("http://www.example.com");
+            BOOST_TEST(u0.is_inline());
+            BOOST_TEST_EQ(u0.buffer(), "http://www.example.com");
+
+            small_url<8> u1("http://www.example.com");
+            BOOST_TEST(! u1.is_inline());
+            BOOST_TEST_EQ(u1.buffer(), "http://www.example.com");
+            BOOST_TEST_GE(u1.capacity(), u1.size());
+        }
+
+        // small_url(small_url const&)
+        // small_url(url_view_base const&)
+        {
+            small_url<24> u0("/path/to/file.txt");
+            small_url<24> u1(u0);
+            BOOST_TEST_EQ(u0.buffer(), u1.buffer());
+            BOOST_TEST_NE(u0.buffer().data(), u1.buffer().data());
+            BOOST_TEST(u1.is_inline());
+
+            small_url<4> u2(u0);
+            BOOST_TEST_EQ(u2.buffer(), u0.buffer());
+            BOOST_TEST(! u2.is_inline());
+            small_url<4> u3(u2);
+            BOOST_TEST_EQ(u3.buffer(), u0.buffer());
+            BOOST_TEST_NE(u3.buffer().data(), u2.buffer().data());
+
+            BOOST_TEST_EQ(small_url<4>(url_view(
+                "/path/to/file.txt")).buffer(),
+                "/path/to/file.txt");
+        }
+
+        // small_url(small_url&&)
+        {
+            // inline
+            small_url<24> u0("/path/to/file.txt");
+            small_url<24> u1(std::move(u0));
+            BOOST_TEST_EQ(u1.buffer(), "/path/to/file.txt");
+            BOOST_TEST(u1.is_inline());
+            BOOST_TEST(u0.empty());
+            BOOST_TEST(u0.is_inline());
+
+            // heap
+            small_url<4> u2("/path/to/file.txt");
+            char const* p = u2.buffer().data();
+            small_url<4> u3(std::move(u2));
+            BOOST_TEST_EQ(u3.buffer().data(), p);
+            BOOST_TEST_EQ(u3.buffer(), "/path/to/file.txt");
+            BOOST_TEST(u2.empty());
+            BOOST_TEST(u2.is_inline());
+            BOOST_TEST_EQ(u2.capacity(), 4u);
+            u2.set_path("/x");
+            BOOST_TEST_EQ(u2.buffer(), "/x");
+        }
+
+        // operator=(small_url const&)
+        // operator=(url_view_base const&)
+        {
+            small_url<8> u0("/path/to/file.txt");
+            small_url<8> u1("/a");
+            u1 = u0;
+            BOOST_TEST_EQ(u1.buffer(), u0.buffer());
+            BOOST_TEST(! u1.is_inline());
+            u1 = u1;
+            BOOST_TEST_EQ(u1.buffer(), u0.buffer());
+            u1 = url_view("/b");
+            BOOST_TEST_EQ(u1.buffer(), "/b");
+            // capacity is preserved
+            BOOST_TEST(! u1.is_inline());
+        }
+
+        // operator=(small_url&&)
+        {
+            small_url<8> u0("/path/to/file.txt");
+            small_url<8> u1("/path/to/other/file.txt");
+            u1 = std::move(u0);
+            BOOST_TEST_EQ(u1.buffer(), "/path/to/file.txt");
+            BOOST_TEST(u0.empty());
+
+            small_url<8> u2("/a");
+            u1 = std::move(u2);
+            BOOST_TEST_EQ(u1.buffer(), "/a");
+            BOOST_TEST(u2.empty());
+
+            u1 = std::move(u1);
+            BOOST_TEST_EQ(u1.buffer(), "/a");
+        }
+    }
+
+    void
+    testGrowth()
+    {
+        // spill while modifying
+        {
+            small_url<16> u("http://a.com");
+            BOOST_TEST(u.is_inline());
+            u.set_path("/path/to/file.txt");
+            BOOST_TEST(! u.is_inline());
+            BOOST_TEST_EQ(u.buffer(),
+                "http://a.com/path/to/file.txt");
+            u.set_encoded_query("k=v");
+            u.set_fragment("frag");
+            BOOST_TEST_EQ(u.buffer(),
+                "http://a.com/path/to/file.txt?k=v#frag");
+            u.clear();
+            BOOST_TEST(u.empty());
+            BOOST_TEST_EQ(*u.c_str(), '\0');
+        }
+
+        // arguments referencing the buffer
+        {
+            small_url<8> u("/abcdef");
+            u.set_encoded_query(u.encoded_path());
+            BOOST_TEST_EQ(u.buffer(), "/abcdef?/abcdef");
+            u.set_encoded_fragment(u.buffer());
+            BOOST_TEST_EQ(u.buffer(),
+                "/abcdef?/abcdef#/abcdef?/abcdef");
+        }
+
+        // repeated growth
+        {
+            small_url<4> u("/");
+            std::string s;
+            for(int i = 0; i < 100; ++i)
+            {
+                u.segments().push_back("seg");
+                s += "/seg";
+            }
+            BOOST_TEST_EQ(u.buffer(), s);
+        }
+
+        // reserve
+        {
+            small_url<8> u("/a");
+            u.reserve(4);
+            BOOST_TEST(u.is_inline());
+            u.reserve(100);
+            BOOST_TEST(! u.is_inline());
+            BOOST_TEST_GE(u.capacity(), 100u);
+            BOOST_TEST_EQ(u.buffer(), "/a");
+        }
+    }
+
+    void
+    testJavadocs()
+    {
+        // small_url
+        {
+        small_url< 128 > u( "https://www.example.com" );
+
+        assert( u.is_inline() );
+        }
+    }
+
+    void
+    run()
+    {
+        testSpecial();
+        testGrowth();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    small_url_test,
+    "boost.url.small_url");
+
+} // urls
+} // boost
@@ -1616,6 +1616,30 @@ decode_with_token()
         //]
     }
 
+    {
+        //[snippet_string_token_6
+        url_view u("http://www.example.com/my%20file.txt?id=42");
+        char buf[256];
+        string_token::arena a(buf, sizeof(buf));
+        boost::core::string_view path = u.path(string_token::in_arena(a));
+        boost::core::string_view query = u.query(string_token::in_arena(a));
+        assert(path == "/my file.txt");
+        assert(query == "id=42");
+        a.release();
+        //]
+    }
+
+    {
+        //[snippet_string_token_7
+        url_view u("http://www.example.com/my%20file.txt");
+        char buf[8];
+        boost::system::result<boost::core::string_view> rv =
+            u.path(string_token::write_to(buf, sizeof(buf)));
+        assert(rv.has_error());
+        assert(boost::core::string_view(buf, sizeof(buf)) == "/my file");
+        //]
+    }
+
     {
 #if defined(__cpp_static_assert) && __cpp_static_assert >= 201411L
         //[snippet_string_token_5
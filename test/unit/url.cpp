@@ -193,6 +193,18 @@ struct url_test
             BOOST_TEST(u.empty());
             BOOST_TEST_EQ(u.size(), 0u);
         }
+
+        // persist
+        {
+            std::shared_ptr<url_view const> sp;
+            {
+                url u("http://example.com/a/b?k=v");
+                sp = u.persist();
+            }
+            BOOST_TEST_EQ(sp->buffer(), "http://example.com/a/b?k=v");
+            BOOST_TEST_EQ(sp->segments().size(), 2u);
+            BOOST_TEST_EQ(sp->params().size(), 1u);
+        }
     }
 
     //--------------------------------------------
@@ -1134,6 +1146,18 @@ struct url_test
             // issue 818
             check("HtTp://cppalliance.org/%2F",
                   "http://cppalliance.org/%2F");
+            // ipv6
+            check("http://[0:0:0:0:0:0:0:1]/",
+                  "http://[::1]/");
+            check("http://[2001:DB8:0:0:1:0:0:1]:80/",
+                  "http://[2001:db8::1:0:0:1]:80/");
+            check("http://[0:0::FFFF:7F00:1]/",
+                  "http://[::ffff:127.0.0.1]/");
+            check("http://[1:0:2:3:4:5:6:7]/",
+                  "http://[1:0:2:3:4:5:6:7]/");
+            BOOST_TEST_NE(
+                url("http://[::1%25eth0]/"),
+                url("http://[0::1%25eth0]/"));
 
         }
 
@@ -0,0 +1,227 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_blocklist.hpp>
+
+#include <boost/url/grammar/error.hpp>
+#include <boost/url/url_view.hpp>
+#include <string>
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct url_blocklist_test
+{
+    static
+    boost::optional<std::size_t>
+    find(
+        url_blocklist const& bl,
+        core::string_view s)
+    {
+        return bl.find(url_view(s));
+    }
+
+    void
+    testHost()
+    {
+        url_blocklist bl;
+        BOOST_TEST_EQ(bl.size(), 0);
+        BOOST_TEST(! find(bl, "http://example.com/"));
+
+        BOOST_TEST_EQ(bl.add_host("example.com"), 0);
+        BOOST_TEST_EQ(bl.add_host("Ads.Example.NET"), 1);
+        BOOST_TEST_EQ(bl.add_host(".tracker.org."), 2);
+        BOOST_TEST_EQ(bl.add_host("%65vil.com"), 3);
+        BOOST_TEST_EQ(bl.size(), 4);
+
+        // duplicates
+        BOOST_TEST_EQ(bl.add_host("EXAMPLE.com"), 0);
+        BOOST_TEST_EQ(bl.add("example.com", "/"), 0);
+        BOOST_TEST_EQ(bl.size(), 4);
+
+        BOOST_TEST(find(bl, "http://example.com") == std::size_t(0));
+        BOOST_TEST(find(bl, "http://WWW.EXAMPLE.COM/x") == std::size_t(0));
+        BOOST_TEST(find(bl, "//a.b.example.com.") == std::size_t(0));
+        BOOST_TEST(! find(bl, "http://badexample.com/"));
+        BOOST_TEST(! find(bl, "http://example.com.au/"));
+        BOOST_TEST(! find(bl, "http://com/"));
+
+        BOOST_TEST(find(bl, "http://ads.example.net/") == std::size_t(1));
+        BOOST_TEST(find(bl, "http://x.ads.example.net/") == std::size_t(1));
+        BOOST_TEST(! find(bl, "http://example.net/"));
+        BOOST_TEST(! find(bl, "http://xads.example.net/"));
+
+        BOOST_TEST(find(bl, "http://tracker.org/") == std::size_t(2));
+        BOOST_TEST(find(bl, "http://evil.com/") == std::size_t(3));
+        BOOST_TEST(find(bl, "http://%45vil.com/") == std::size_t(3));
+
+        BOOST_TEST(! find(bl, "/path"));
+        BOOST_TEST(! find(bl, "mailto:a@example.com"));
+
+        // encoded dots separate labels
+        BOOST_TEST(find(bl, "http://www.example%2Ecom/") == std::size_t(0));
+        BOOST_TEST(find(bl, "http://www%2eexample%2Ecom%2E/") == std::size_t(0));
+        BOOST_TEST(find(bl, "http://ads%2Eexample.net/") == std::size_t(1));
+        BOOST_TEST(! find(bl, "http://badexample%2Ecom.au/"));
+        BOOST_TEST(! find(bl, "http://www.example%252Ecom/"));
+
+        BOOST_TEST_THROWS(
+            bl.add_host("%zz"),
+            system::system_error);
+    }
+
+    void
+    testPath()
+    {
+        url_blocklist bl;
+        BOOST_TEST_EQ(bl.add_path("/ads/"), 0);
+        BOOST_TEST_EQ(bl.add_path("/a/b"), 1);
+        BOOST_TEST_EQ(bl.add("example.com", "/private"), 2);
+        BOOST_TEST_EQ(bl.add("www.example.com", "/x%20y"), 3);
+        BOOST_TEST_EQ(bl.add_path("/ads"), 0);
+
+        BOOST_TEST(find(bl, "http://h/ads") == std::size_t(0));
+        BOOST_TEST(find(bl, "http://h/ads/") == std::size_t(0));
+        BOOST_TEST(find(bl, "/ads/1/2") == std::size_t(0));
+        BOOST_TEST(find(bl, "ads/1") == std::size_t(0));
+        BOOST_TEST(! find(bl, "/adsx"));
+        BOOST_TEST(! find(bl, "/"));
+        BOOST_TEST(find(bl, "/a/b/c") == std::size_t(1));
+        BOOST_TEST(find(bl, "/a/%62") == std::size_t(1));
+        BOOST_TEST(! find(bl, "/a/B"));
+        BOOST_TEST(! find(bl, "/a"));
+
+        BOOST_TEST(find(bl, "http://example.com/private/1") == std::size_t(2));
+        BOOST_TEST(find(bl, "http://w.example.com/private") == std::size_t(2));
+        BOOST_TEST(! find(bl, "http://example.org/private"));
+        BOOST_TEST(! find(bl, "http://example.com/public"));
+        BOOST_TEST(! find(bl, "/private"));
+
+        BOOST_TEST(find(bl, "http://www.example.com/x%20y") == std::size_t(3));
+        BOOST_TEST(! find(bl, "http://example.com/x%20y"));
+
+        // dot segments are removed
+        BOOST_TEST(find(bl, "http://x.org/a/../ads") == std::size_t(0));
+        BOOST_TEST(find(bl, "http://x.org/./ads") == std::size_t(0));
+        BOOST_TEST(find(bl, "http://x.org/%61ds") == std::size_t(0));
+        BOOST_TEST(find(bl, "http://x.org/x/%2E%2e/ads/1") == std::size_t(0));
+        BOOST_TEST(find(bl, "http://x.org/../../ads") == std::size_t(0));
+        BOOST_TEST(find(bl, "http://x.org/a/./b/c/..") == std::size_t(1));
+        BOOST_TEST(find(bl, "http://example.com/q/.%2E/private") == std::size_t(2));
+        BOOST_TEST(! find(bl, "http://x.org/ads/../x"));
+        BOOST_TEST(! find(bl, "http://x.org/a/b/../../a"));
+        BOOST_TEST(! find(bl, "http://x.org/a/.../b"));
+
+        // shorter host suffixes first
+        BOOST_TEST(find(bl,
+            "http://www.example.com/private") == std::size_t(2));
+
+        // a rule for every url
+        BOOST_TEST_EQ(bl.add("", ""), 4);
+        BOOST_TEST(find(bl, "") == std::size_t(4));
+        BOOST_TEST(find(bl, "/ads") == std::size_t(4));
+
+        // bypasses
+        {
+            url_blocklist bl2;
+            bl2.add_host("example.com");
+            bl2.add_path("/admin");
+            BOOST_TEST(bl2.blocked(url_view("http://www.example%2Ecom/")));
+            BOOST_TEST(bl2.blocked(url_view("http://x.org/a/../admin")));
+            BOOST_TEST(bl2.blocked(url_view("http://x.org/./admin")));
+            BOOST_TEST(bl2.blocked(url_view("http://x.org/%61dmin")));
+        }
+    }
+
+    void
+    testSerialize()
+    {
+        url_blocklist bl;
+        for(int i = 0; i < 1000; ++i)
+            bl.add_host("h" + std::to_string(i) + ".example.com");
+        bl.add("example.org", "/a/b");
+        bl.add_path("/ads");
+        BOOST_TEST_EQ(bl.size(), 1002);
+        BOOST_TEST_GT(bl.memory_usage(), 0);
+
+        auto const s = bl.serialize();
+        auto rv = url_blocklist::deserialize(s);
+        BOOST_TEST(rv.has_value());
+        url_blocklist const& bl2 = *rv;
+        BOOST_TEST_EQ(bl2.size(), 1002);
+        BOOST_TEST(find(bl2, "http://x.h999.example.com/") == std::size_t(999));
+        BOOST_TEST(find(bl2, "http://example.org/a/b/c") == std::size_t(1000));
+        BOOST_TEST(find(bl2, "http://example.net/ads") == std::size_t(1001));
+        BOOST_TEST(! find(bl2, "http://example.com/"));
+        BOOST_TEST_EQ(bl2.serialize(), s);
+
+        // can still add
+        url_blocklist bl3 = *rv;
+        BOOST_TEST_EQ(bl3.add_host("example.net"), 1002);
+        BOOST_TEST(find(bl3, "http://example.net/") == std::size_t(1002));
+
+        // invalid
+        BOOST_TEST(url_blocklist::deserialize("").error() ==
+            grammar::error::invalid);
+        BOOST_TEST(url_blocklist::deserialize(
+            s.substr(0, s.size() - 1)).has_error());
+        {
+            std::string s1 = s;
+            s1[0] = 'x';
+            BOOST_TEST(url_blocklist::deserialize(s1).has_error());
+        }
+        {
+            // node 1 refers to a missing rule
+            std::string s1 = s;
+            s1[24 + 24 + 16] = '\xfe';
+            s1[24 + 24 + 17] = '\xfe';
+            BOOST_TEST(url_blocklist::deserialize(s1).has_error());
+        }
+    }
+
+    void
+    testJavadocs()
+    {
+        // url_blocklist
+        {
+        url_blocklist bl;
+        auto id0 = bl.add_host( "ads.example.com" );
+        auto id1 = bl.add( "example.org", "/tracking" );
+
+        assert( bl.find( url_view( "https://x.ADS.example.com/" ) ) == id0 );
+        assert( bl.find( url_view( "https://www.example.org/tracking/1" ) ) == id1 );
+        assert( ! bl.blocked( url_view( "https://www.example.org/tracker" ) ) );
+        assert( ! bl.blocked( url_view( "https://badexample.org/tracking" ) ) );
+        }
+    }
+
+    void
+    run()
+    {
+        testHost();
+        testPath();
+        testSerialize();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    url_blocklist_test,
+    "boost.url.url_blocklist");
+
+} // urls
+} // boost
@@ -0,0 +1,193 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_corpus.hpp>
+
+#include <boost/url/grammar/error.hpp>
+#include <string>
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct url_corpus_test
+{
+    using options = url_corpus::options;
+
+    void
+    testSpecial()
+    {
+        // url_corpus()
+        {
+            url_corpus uc;
+            BOOST_TEST(uc.chunks().empty());
+            BOOST_TEST_EQ(uc.lines(), 0);
+            BOOST_TEST_EQ(uc.size(), 0);
+            BOOST_TEST_EQ(uc.errors(), 0);
+        }
+
+        // url_corpus(string_view)
+        {
+            url_corpus uc("");
+            BOOST_TEST(uc.chunks().empty());
+            BOOST_TEST_EQ(uc.lines(), 0);
+        }
+
+        // url_corpus(string_view, options)
+        {
+            options opt;
+            opt.chunk_size = 0;
+            BOOST_TEST_THROWS(
+                url_corpus("x", opt),
+                system::system_error);
+        }
+    }
+
+    void
+    testLines()
+    {
+        {
+            core::string_view s =
+                "http://a.com/1\r\n"
+                "\n"
+                "/2\n"
+                "http://[\n"
+                "\r\n"
+                "x:3";
+            url_corpus uc(s);
+            BOOST_TEST_EQ(uc.lines(), 6);
+            BOOST_TEST_EQ(uc.size(), 3);
+            BOOST_TEST_EQ(uc.errors(), 1);
+            if(! BOOST_TEST_EQ(uc.chunks().size(), 1))
+                return;
+            auto const& c = uc.chunks()[0];
+            BOOST_TEST_EQ(c.text, s);
+            BOOST_TEST_EQ(c.first_line, 0);
+            BOOST_TEST_EQ(c.lines, 6);
+            BOOST_TEST_EQ(c.errors, 1);
+            BOOST_TEST_EQ(c.first_error_line, 3);
+            BOOST_TEST(c.first_error);
+            if(! BOOST_TEST_EQ(c.urls.size(), 3))
+                return;
+            BOOST_TEST_EQ(c.urls[0].buffer(), "http://a.com/1");
+            BOOST_TEST_EQ(c.urls[1].buffer(), "/2");
+            BOOST_TEST_EQ(c.urls[2].buffer(), "x:3");
+
+            // references the text
+            BOOST_TEST_EQ(c.urls[0].data(), s.data());
+            BOOST_TEST_EQ(c.urls[2].data(), s.data() + s.size() - 3);
+        }
+
+        // no trailing newline
+        {
+            url_corpus uc("a\nb");
+            BOOST_TEST_EQ(uc.lines(), 2);
+            BOOST_TEST_EQ(uc.size(), 2);
+        }
+        {
+            url_corpus uc("a\nb\n");
+            BOOST_TEST_EQ(uc.lines(), 2);
+            BOOST_TEST_EQ(uc.size(), 2);
+        }
+    }
+
+    void
+    testChunks()
+    {
+        // each chunk ends after a newline
+        std::string s;
+        std::size_t const n = 5000;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            if(i % 7 == 3)
+                s.append("http://[" + std::to_string(i));
+            else
+                s.append("https://www.example.com/" +
+                    std::to_string(i));
+            s.push_back('\n');
+        }
+
+        for(std::size_t threads : { 1, 2, 4, 16 })
+        for(std::size_t chunk_size : { 1, 100, 4096, 1000000 })
+        {
+            options opt;
+            opt.threads = threads;
+            opt.chunk_size = chunk_size;
+            url_corpus uc(s, opt);
+            BOOST_TEST_EQ(uc.lines(), n);
+            BOOST_TEST_EQ(uc.size() + uc.errors(), n);
+            BOOST_TEST_EQ(uc.errors(), (n + 3) / 7);
+
+            std::size_t line = 0;
+            std::size_t count = 0;
+            char const* p = s.data();
+            for(auto const& c : uc.chunks())
+            {
+                BOOST_TEST_EQ(c.text.data(), p);
+                BOOST_TEST(c.text.ends_with('\n'));
+                BOOST_TEST_EQ(c.first_line, line);
+                if(c.errors)
+                {
+                    BOOST_TEST_EQ(c.first_error,
+                        grammar::error::mismatch);
+                    BOOST_TEST_EQ(c.first_error_line % 7, 3);
+                    BOOST_TEST_GE(c.first_error_line, line);
+                    BOOST_TEST_LT(c.first_error_line, line + c.lines);
+                }
+                for(auto const& u : c.urls)
+                {
+                    while(count % 7 == 3)
+                        ++count;
+                    BOOST_TEST_EQ(u.encoded_path(),
+                        "/" + std::to_string(count));
+                    ++count;
+                }
+                p += c.text.size();
+                line += c.lines;
+            }
+            BOOST_TEST_EQ(p, s.data() + s.size());
+        }
+    }
+
+    void
+    testJavadocs()
+    {
+        // url_corpus
+        {
+        url_corpus uc( "https://www.example.com\n/index.htm\nhttp://[\n" );
+
+        assert( uc.size() == 2 );
+        assert( uc.errors() == 1 );
+        assert( uc.chunks()[0].urls[1].encoded_path() == "/index.htm" );
+        }
+    }
+
+    void
+    run()
+    {
+        testSpecial();
+        testLines();
+        testChunks();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    url_corpus_test,
+    "boost.url.url_corpus");
+
+} // urls
+} // boost
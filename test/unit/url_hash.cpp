@@ -0,0 +1,149 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_hash.hpp>
+
+#include <boost/url/shared_url.hpp>
+#include <boost/url/static_url.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/unordered_set.hpp>
+#include <string>
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct url_hash_test
+{
+    static
+    void
+    check(
+        core::string_view s0,
+        core::string_view s1)
+    {
+        url_hash h;
+        url_equal eq;
+        url_view u0(s0);
+        url u1(s1);
+        BOOST_TEST(eq(u0, u1));
+        BOOST_TEST(eq(u0, s1));
+        BOOST_TEST(eq(s0, u1));
+        BOOST_TEST(eq(s0, s1));
+        BOOST_TEST_EQ(h(u0), h(u1));
+        BOOST_TEST_EQ(h(s0), h(u1));
+        BOOST_TEST_EQ(h(s0), h(s1));
+        BOOST_TEST_EQ(h(u0), std::hash<url_view>()(u0));
+        url_hash h10(10);
+        BOOST_TEST_EQ(h10(s0), h10(u1));
+        BOOST_TEST_EQ(h10(u0),
+            std::hash<url_view>(10)(u0));
+    }
+
+    void
+    testFunctors()
+    {
+        check("http://example.com", "http://example.com");
+        check("http://example.com", "HTTP://EXAMPLE.COM");
+        check("http://example.com/a/./b/../c",
+              "http://example.com/a/c");
+        check("/path?%61=1", "/path?a=1");
+        check("http://[0:0::1]/", "http://[::1]/");
+        check("", "");
+        check(".", "");
+        check("a/..", "%2E");
+        check("./a/b/c/./../../g", "a/g");
+        check("/.//a", "/.//a");
+
+        url_equal eq;
+        BOOST_TEST(! eq(url_view("http://a.com"), "http://b.com"));
+        BOOST_TEST(! eq("http://b.com", url_view("http://a.com")));
+        BOOST_TEST(! eq("http://a.com", "http://b.com"));
+        BOOST_TEST(! eq("...", "."));
+        BOOST_TEST(! eq("a", "."));
+
+        // invalid strings
+        BOOST_TEST(eq("%", "%"));
+        BOOST_TEST(! eq("%", "%%"));
+        BOOST_TEST(! eq("%", "http://a.com"));
+        BOOST_TEST(! eq("http://a.com", "%"));
+        BOOST_TEST(! eq(url_view("http://a.com"), "%"));
+        BOOST_TEST_EQ(url_hash()("%"), url_hash()("%"));
+
+        // other url types
+        static_url<64> su("HTTP://example.com");
+        shared_url sh("http://EXAMPLE.com");
+        std::string s("http://example.com");
+        BOOST_TEST(eq(su, sh));
+        BOOST_TEST(eq(sh, s));
+        BOOST_TEST_EQ(url_hash()(su), url_hash()(sh));
+        BOOST_TEST_EQ(url_hash()(s), url_hash()(sh));
+    }
+
+    void
+    testLookup()
+    {
+        boost::unordered_set<
+            url, url_hash, url_equal> s;
+        s.emplace("https://www.example.com/index.htm");
+        s.emplace("https://www.example.com/a/b?x=1");
+
+        BOOST_TEST(s.find(
+            url_view("https://www.example.com/index.htm")) != s.end());
+        BOOST_TEST(s.find(url_view(
+            "HTTPS://www.EXAMPLE.com/./index.htm")) != s.end());
+        BOOST_TEST(s.find(url_view(
+            "https://www.example.com/a/c/../b?%78=1")) != s.end());
+        BOOST_TEST(s.find(url_view(
+            "https://www.example.com/a/b?x=2")) == s.end());
+        BOOST_TEST_EQ(s.count(
+            url_view("https://www.example.com/a/b?x=1")), 1u);
+    }
+
+    void
+    testJavadocs()
+    {
+        // url_hash
+        {
+        boost::unordered_set< url, url_hash, url_equal > s;
+        s.emplace( "https://www.example.com/index.htm" );
+
+        assert( s.find( url_view( "HTTPS://www.EXAMPLE.com/./index.htm" ) ) != s.end() );
+        }
+
+        // url_equal
+        {
+        url_equal eq;
+
+        assert( eq( url_view( "http://example.com" ), "HTTP://EXAMPLE.COM" ) );
+        }
+    }
+
+    void
+    run()
+    {
+        testFunctors();
+        testLookup();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    url_hash_test,
+    "boost.url.url_hash");
+
+} // urls
+} // boost
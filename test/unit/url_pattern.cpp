@@ -0,0 +1,168 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_pattern.hpp>
+
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <string>
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct url_pattern_test
+{
+    static
+    bool
+    path_match(
+        core::string_view pattern,
+        core::string_view path)
+    {
+        url u("http://example.com");
+        u.set_encoded_path(path);
+        return url_pattern()
+            .set_pathname(pattern)
+            .match(u);
+    }
+
+    void
+    testGlob()
+    {
+        // literal
+        BOOST_TEST(path_match("/a/b", "/a/b"));
+        BOOST_TEST(! path_match("/a/b", "/a/bc"));
+        BOOST_TEST(! path_match("/a/b", "/a/"));
+        BOOST_TEST(path_match("", ""));
+        BOOST_TEST(! path_match("", "/"));
+
+        // *
+        BOOST_TEST(path_match("/*", "/"));
+        BOOST_TEST(path_match("/*", "/abc"));
+        BOOST_TEST(! path_match("/*", "/a/b"));
+        BOOST_TEST(path_match("/a*c", "/ac"));
+        BOOST_TEST(path_match("/a*c", "/abbbc"));
+        BOOST_TEST(path_match("/a*c", "/acbc"));
+        BOOST_TEST(! path_match("/a*c", "/acb"));
+        BOOST_TEST(path_match("/*/*.txt", "/a/b.txt"));
+        BOOST_TEST(! path_match("/*/*.txt", "/a/b/c.txt"));
+        BOOST_TEST(path_match("*", ""));
+
+        // **
+        BOOST_TEST(path_match("/**", "/"));
+        BOOST_TEST(path_match("/**", "/a/b/c"));
+        BOOST_TEST(path_match("/**.txt", "/a/b/c.txt"));
+        BOOST_TEST(! path_match("/**.txt", "/a/b/c.txt/d"));
+        BOOST_TEST(path_match("/a/***", "/a/b/c"));
+        BOOST_TEST(path_match("**/c", "/a/b/c"));
+        BOOST_TEST(! path_match("**/c", "/a/b/cd"));
+
+        // escapes
+        BOOST_TEST(path_match("/a\\*", "/a*"));
+        BOOST_TEST(! path_match("/a\\*", "/ab"));
+        BOOST_TEST(path_match("/\\a", "/a"));
+        BOOST_TEST_THROWS(
+            url_pattern().set_pathname("/a\\"),
+            system::system_error);
+
+        // case
+        BOOST_TEST(! path_match("/A", "/a"));
+
+        // long patterns use more than one word
+        std::string p;
+        std::string s;
+        for(int i = 0; i < 100; ++i)
+        {
+            p += "/*";
+            s += "/x";
+        }
+        BOOST_TEST(path_match(p, s));
+        BOOST_TEST(! path_match(p, s + "/"));
+        BOOST_TEST(path_match(p + "/**", s + "/y/z"));
+    }
+
+    void
+    testComponents()
+    {
+        url_pattern p;
+        BOOST_TEST_EQ(p.protocol(), "**");
+        BOOST_TEST_EQ(p.hostname(), "**");
+        BOOST_TEST_EQ(p.pathname(), "**");
+        BOOST_TEST_EQ(p.search(), "**");
+        BOOST_TEST_EQ(p.hash(), "**");
+        BOOST_TEST(p.match(url_view()));
+        BOOST_TEST(p.match(url_view(
+            "https://user@host:80/path?q#f")));
+
+        p.set_protocol("HTTP");
+        BOOST_TEST_EQ(p.protocol(), "HTTP");
+        BOOST_TEST(p.match(url_view("http://x")));
+        BOOST_TEST(p.match(url_view("HtTp://x")));
+        BOOST_TEST(! p.match(url_view("https://x")));
+        BOOST_TEST(! p.match(url_view("/x")));
+
+        p = url_pattern().set_hostname("*.Example.com");
+        BOOST_TEST(p.match(url_view("http://WWW.example.COM/")));
+        BOOST_TEST(! p.match(url_view("http://example.com/")));
+        BOOST_TEST(p.match(url_view("http://a.b.example.com/")));
+
+        p = url_pattern()
+            .set_search("q=*")
+            .set_hash("");
+        BOOST_TEST(p.match(url_view("/?q=1")));
+        BOOST_TEST(p.match(url_view("/?q=1#")));
+        BOOST_TEST(! p.match(url_view("/?q=1#f")));
+        BOOST_TEST(! p.match(url_view("/?r=1")));
+        BOOST_TEST(! p.match(url_view("/")));
+
+        // strong guarantee
+        p = url_pattern().set_pathname("/a");
+        BOOST_TEST_THROWS(
+            p.set_pathname("\\"),
+            system::system_error);
+        BOOST_TEST_EQ(p.pathname(), "/a");
+        BOOST_TEST(p.match(url_view("/a")));
+        BOOST_TEST(! p.match(url_view("/b")));
+    }
+
+    void
+    testJavadocs()
+    {
+        // url_pattern
+        {
+        url_pattern p;
+        p.set_protocol( "http*" ).set_hostname( "**.example.com" ).set_pathname( "**.html" );
+
+        assert( p.match( url_view( "https://www.example.com/docs/a/b.html" ) ) );
+        assert( ! p.match( url_view( "https://example.org/docs/a/b.html" ) ) );
+        }
+    }
+
+    void
+    run()
+    {
+        testGlob();
+        testComponents();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    url_pattern_test,
+    "boost.url.url_pattern");
+
+} // urls
+} // boost
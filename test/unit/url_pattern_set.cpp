@@ -0,0 +1,186 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_pattern_set.hpp>
+
+#include <boost/url/url_view.hpp>
+#include <string>
+#include <vector>
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct url_pattern_set_test
+{
+    static
+    std::vector<std::size_t>
+    match(
+        url_pattern_set const& rules,
+        core::string_view s)
+    {
+        std::vector<std::size_t> ids;
+        rules.match(url_view(s), ids);
+        return ids;
+    }
+
+    void
+    testMatch()
+    {
+        using V = std::vector<std::size_t>;
+
+        // empty
+        {
+            url_pattern_set rules;
+            BOOST_TEST(rules.empty());
+            BOOST_TEST(match(rules, "http://x") == V{});
+        }
+
+        // rules without patterns match everything
+        {
+            url_pattern_set rules = {
+                url_pattern(),
+                url_pattern() };
+            BOOST_TEST_EQ(rules.size(), 2);
+            BOOST_TEST(match(rules, "") == V({ 0, 1 }));
+        }
+
+        url_pattern_set rules = {
+            url_pattern().set_protocol("https"),
+            url_pattern().set_hostname("*.example.com"),
+            url_pattern()
+                .set_hostname("*.example.com")
+                .set_pathname("/a/**"),
+            url_pattern().set_pathname("**.txt"),
+            url_pattern().set_search("*"),
+            url_pattern().set_hash("top") };
+        BOOST_TEST_EQ(rules.size(), 6);
+        BOOST_TEST_EQ(rules[2].pathname(), "/a/**");
+
+        BOOST_TEST(match(rules,
+            "https://www.example.com/a/b.txt") ==
+                V({ 0, 1, 2, 3, 4 }));
+        BOOST_TEST(match(rules,
+            "http://WWW.EXAMPLE.COM/b") ==
+                V({ 1, 4 }));
+        BOOST_TEST(match(rules,
+            "http://example.com/b?x/y#top") ==
+                V({ 5 }));
+        BOOST_TEST(match(rules,
+            "http://example.com/b?x/y") ==
+                V{});
+
+        // ids are appended
+        std::vector<std::size_t> ids = { 42 };
+        rules.match(url_view("ftp://h/f.txt"), ids);
+        BOOST_TEST(ids == V({ 42, 3, 4 }));
+
+        // add
+        BOOST_TEST_EQ(rules.add(
+            url_pattern().set_protocol("ftp")), 6);
+        BOOST_TEST(match(rules,
+            "ftp://h/f.txt") == V({ 3, 4, 6 }));
+    }
+
+    void
+    testMany()
+    {
+        // many rules, each matching one host
+        std::vector<url_pattern> v;
+        for(int i = 0; i < 500; ++i)
+            v.push_back(url_pattern()
+                .set_hostname("*.host" +
+                    std::to_string(i) + ".com")
+                .set_pathname("/" +
+                    std::to_string(i % 7) + "/**"));
+        v.push_back(url_pattern().set_pathname("/3/**"));
+        url_pattern_set rules(v.begin(), v.end());
+        BOOST_TEST_EQ(rules.size(), 501);
+
+        using V = std::vector<std::size_t>;
+        BOOST_TEST(match(rules,
+            "http://www.host123.com/4/x") == V({ 123 }));
+        BOOST_TEST(match(rules,
+            "http://www.host123.com/3/x") == V({ 500 }));
+        BOOST_TEST(match(rules,
+            "http://www.host499.com/2/x/y") == V({ 499 }));
+        BOOST_TEST(match(rules,
+            "http://www.host64.com/1/") == V({ 64 }));
+        BOOST_TEST(match(rules,
+            "http://host64.com/1/") == V{});
+
+        // added at once
+        {
+            url_pattern_set rules2 = {
+                url_pattern().set_protocol("ftp") };
+            BOOST_TEST_EQ(rules2.add(
+                v.begin(), v.end()), 1);
+            BOOST_TEST_EQ(rules2.add(
+                v.begin(), v.begin()), 502);
+            BOOST_TEST_EQ(rules2.size(), 502);
+            BOOST_TEST(match(rules2,
+                "ftp://www.host123.com/4/x") == V({ 0, 124 }));
+            BOOST_TEST(match(rules2,
+                "http://www.host499.com/2/x/y") == V({ 500 }));
+        }
+
+        // agrees with each pattern alone
+        for(auto s : {
+            "http://a.host10.com/3/z",
+            "http://a.host10.com/4/z",
+            "http://a.host0.com/0/",
+            "http://a.host0.com/0" })
+        {
+            V expect;
+            for(std::size_t i = 0; i < v.size(); ++i)
+                if(v[i].match(url_view(s)))
+                    expect.push_back(i);
+            BOOST_TEST(match(rules, s) == expect);
+        }
+    }
+
+    void
+    testJavadocs()
+    {
+        // url_pattern_set
+        {
+        url_pattern_set rules = {
+            url_pattern().set_hostname( "**.example.com" ),
+            url_pattern().set_pathname( "**.html" ),
+            url_pattern().set_protocol( "ftp" ) };
+
+        std::vector< std::size_t > ids;
+        rules.match( url_view( "https://www.example.com/docs/index.html" ), ids );
+
+        assert( ids.size() == 2 && ids[0] == 0 && ids[1] == 1 );
+        }
+    }
+
+    void
+    run()
+    {
+        testMatch();
+        testMany();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    url_pattern_set_test,
+    "boost.url.url_pattern_set");
+
+} // urls
+} // boost
@@ -0,0 +1,258 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_scanner.hpp>
+
+#include <boost/url/parse.hpp>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct url_scanner_test
+{
+    static
+    void
+    check(
+        core::string_view s,
+        std::initializer_list<
+            core::string_view> init)
+    {
+        url_scanner sc(s);
+        std::vector<core::string_view> v;
+        while(auto u = sc.next())
+        {
+            // references the text
+            BOOST_TEST_GE(u->buffer().data(), s.data());
+            BOOST_TEST_LE(u->buffer().data() +
+                u->buffer().size(), s.data() + s.size());
+            v.push_back(u->buffer());
+        }
+        BOOST_TEST_EQ(sc.offset(), s.size());
+        if(! BOOST_TEST_EQ(v.size(), init.size()))
+            return;
+        auto it = init.begin();
+        for(auto const& e : v)
+            BOOST_TEST_EQ(e, *it++);
+    }
+
+    void
+    testScheme()
+    {
+        check("", {});
+        check("no urls here.", {});
+        check("http://example.com", {"http://example.com"});
+        check("go to https://www.example.com/a/b?c=d#e now",
+            {"https://www.example.com/a/b?c=d#e"});
+        check("a http://a.com b ftp://b.org/x c",
+            {"http://a.com", "ftp://b.org/x"});
+        check("HTTP://EXAMPLE.COM/", {"HTTP://EXAMPLE.COM/"});
+        check("x-y+z://host/", {"x-y+z://host/"});
+        check("1http://host", {"http://host"});
+        check("file:///etc/hosts", {"file:///etc/hosts"});
+        check("http://[::1]:8080/", {"http://[::1]:8080/"});
+        check("mailto:a@b.com", {});
+        check("http://", {});
+        check("http:///x", {});
+        check("://host", {});
+        check(":// http://", {});
+
+        // trailing punctuation
+        check("see http://example.com.", {"http://example.com"});
+        check("see http://example.com/a, b", {"http://example.com/a"});
+        check("http://example.com/?!", {"http://example.com/"});
+        check("(http://example.com/a)", {"http://example.com/a"});
+        check("http://example.com/a_(b)", {"http://example.com/a_(b)"});
+        check("(see http://example.com/a_(b))",
+            {"http://example.com/a_(b)"});
+        check("http://example.com/a(b", {"http://example.com/a(b"});
+
+        // malformed escapes
+        check("http://example.com/a%2 x", {"http://example.com/a"});
+        check("http://example.com/%zz", {"http://example.com/"});
+        check("http://example.com/a%41", {"http://example.com/a%41"});
+
+        // not url characters
+        check("http://example.com/a b", {"http://example.com/a"});
+        check("http://example.com/a\"b", {"http://example.com/a"});
+        check("http://example.com/a{b}", {"http://example.com/a"});
+        check("http://example.com/\xe2\x82\xac", {"http://example.com/"});
+    }
+
+    void
+    testDelimiters()
+    {
+        check("<http://example.com/a.>", {"http://example.com/a."});
+        check("<a href=\"http://example.com/?q=1&r=2.\">x</a>",
+            {"http://example.com/?q=1&r=2."});
+        check("<a href='http://example.com/x,'>",
+            {"http://example.com/x,"});
+        check("'http://example.com/it's'",
+            {"http://example.com/it"});
+        check("\"http://example.com/a b\"",
+            {"http://example.com/a"});
+        check("<http://example.com/a.", {"http://example.com/a"});
+    }
+
+    void
+    testWww()
+    {
+        check("www.example.com", {"www.example.com"});
+        check("Visit WWW.Example.com/a?b.", {"WWW.Example.com/a?b"});
+        check("(www.example.com)", {"www.example.com"});
+        check("www.example.com:8080/", {"www.example.com"});
+        check("www.example.com:8080/path www.b.com", {"www.example.com", "www.b.com"});
+        check("www.example.com:8080/www.b.com", {"www.example.com"});
+        check("(www.example.com:80/a?b#c) x.www.y", {"www.example.com"});
+        check("www.example.com: see www.b.com", {"www.example.com", "www.b.com"});
+        check("www.", {});
+        check("www. example", {});
+        check("awww.example.com", {});
+        check("a@www.example.com", {});
+        check("http://www.example.com", {"http://www.example.com"});
+        check("www.a.com www.b.com", {"www.a.com", "www.b.com"});
+
+        url_scanner sc("at www.example.com/x");
+        auto u = sc.next();
+        if(BOOST_TEST(u))
+        {
+            BOOST_TEST(! u->has_scheme());
+            BOOST_TEST_EQ(u->encoded_path(), "www.example.com/x");
+            BOOST_TEST_EQ(sc.offset(), 20);
+        }
+
+        // the port and the rest are skipped
+        {
+            core::string_view s =
+                "at www.example.com:8080/a/b?c=d#e.";
+            url_scanner sc2(s);
+            auto u2 = sc2.next();
+            if(BOOST_TEST(u2))
+            {
+                BOOST_TEST_EQ(u2->buffer(), "www.example.com");
+                BOOST_TEST(! u2->has_authority());
+                BOOST_TEST_EQ(s.substr(3, sc2.offset() - 3),
+                    "www.example.com:8080/a/b?c=d#e");
+            }
+            BOOST_TEST(! sc2.next());
+        }
+    }
+
+    void
+    testLong()
+    {
+        // exercise the vectorized search
+        std::string s;
+        std::vector<std::string> v;
+        for(std::size_t i = 0; i < 200; ++i)
+        {
+            s.append(i % 37, ' ');
+            s.append("text, with: punctuation. ");
+            std::string u = "https://host" +
+                std::to_string(i) + ".example.com/p?i=" +
+                std::to_string(i);
+            s.append(u);
+            s.append(i % 2 ? ". " : " ");
+            v.push_back(u);
+        }
+        url_scanner sc(s);
+        std::size_t n = 0;
+        while(auto u = sc.next())
+        {
+            if(n < v.size())
+                BOOST_TEST_EQ(u->buffer(), v[n]);
+            ++n;
+        }
+        BOOST_TEST_EQ(n, v.size());
+    }
+
+    void
+    testAdversarial()
+    {
+        // these take quadratic time when a
+        // failed candidate is searched again
+        std::size_t const n = 200000;
+        {
+            std::string s;
+            for(std::size_t i = 0; i < n; ++i)
+                s.append("a:///");
+            check(s, {});
+        }
+        {
+            std::string s = "http://x/";
+            s.append(5 * n, ')');
+            check(s, {"http://x/"});
+        }
+        {
+            std::string s;
+            for(std::size_t i = 0; i < n; ++i)
+                s.append("a://[");
+            s.append("http://x/");
+            check(s, {"http://x/"});
+        }
+        {
+            std::string s;
+            for(std::size_t i = 0; i < n; ++i)
+                s.append("http://x/[");
+            s.append(n, ')');
+            url_scanner sc(s);
+            std::size_t k = 0;
+            while(auto u = sc.next())
+            {
+                BOOST_TEST_EQ(u->buffer(), "http://x/");
+                ++k;
+            }
+            BOOST_TEST_EQ(k, n);
+        }
+    }
+
+    void
+    testJavadocs()
+    {
+        // url_scanner
+        {
+        url_scanner sc( "See <https://www.example.com/a?b=c> or www.boost.org." );
+        std::vector< core::string_view > v;
+        while( auto u = sc.next() )
+            v.push_back( u->buffer() );
+
+        assert( v.size() == 2 );
+        assert( v[0] == "https://www.example.com/a?b=c" );
+        assert( v[1] == "www.boost.org" );
+        }
+    }
+
+    void
+    run()
+    {
+        testScheme();
+        testDelimiters();
+        testWww();
+        testLong();
+        testAdversarial();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    url_scanner_test,
+    "boost.url.url_scanner");
+
+} // urls
+} // boost